@@ -0,0 +1,176 @@
+#pragma once
+
+#include <coroutine>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <optional>
+
+#include "EventT.hpp"
+#include "IEventHandler.hpp"
+#include "IPort.hpp"
+#include "LocalExecutor.hpp"
+
+// Request/response on top of a one-way IPort. Each request is sent with a unique correlation
+// id and the next sequence number of the port's outbound stream; the peer delivers its response
+// to receive(), and the awaiting coroutine is resumed through the executor with the response.
+// A correlated response goes to the request with the same correlation id and an uncorrelated
+// one to the oldest request waiting for its message id; the response's own sequence is not
+// used for matching. Responses nobody waits for are dropped.
+//
+// Lifetime: a request whose awaiting coroutine is destroyed is withdrawn, and its response is
+// dropped. Requests still waiting when the port is destroyed are resumed through the executor
+// with std::nullopt. The executor must outlive the port; if it is destroyed with resumptions
+// still queued, they are dropped and the waiting coroutines stay suspended until their owners
+// destroy them.
+class AsyncPort : public IEventHandler
+{
+    struct Registry;
+
+    struct PendingRequest
+    {
+        std::uint32_t responseId;
+        std::uint32_t correlationId;
+        std::coroutine_handle<> waiter;
+        std::unique_ptr<Event> response;
+        Registry* registry; // set while registered
+    };
+
+    // Shared with the resumptions queued on the executor, so that it outlives the port while
+    // they are queued and is released when they run or are dropped.
+    struct Registry
+    {
+        ~Registry()
+        {
+            for (auto const& entry : pending) {
+                entry.second->registry = nullptr;
+            }
+        }
+
+        static void resume(Registry& p_registry, std::uint32_t p_correlationId)
+        {
+            auto found = p_registry.pending.find(p_correlationId);
+            if (found == p_registry.pending.end()) {
+                return;
+            }
+            auto request = found->second;
+            request->registry = nullptr;
+            p_registry.pending.erase(found);
+            request->waiter.resume();
+        }
+
+        std::map<std::uint32_t, PendingRequest*> pending;
+    };
+
+public:
+    AsyncPort(IPort& p_port, LocalExecutor& p_executor)
+        : m_port(p_port),
+          m_executor(p_executor),
+          m_registry(std::make_shared<Registry>())
+    {}
+
+    ~AsyncPort()
+    {
+        for (auto const& entry : m_registry->pending) {
+            if (not entry.second->response) {
+                resumeLater(entry.first);
+            }
+        }
+    }
+
+    AsyncPort(AsyncPort const&) = delete;
+    AsyncPort& operator=(AsyncPort const&) = delete;
+
+    // p_tick is passed on in the request sequence, e.g. the game tick the request belongs to.
+    template <class Req, class Resp>
+    auto request(Req const& p_request = Req(), std::uint32_t p_tick = 0)
+    {
+        struct Awaiter : PendingRequest
+        {
+            AsyncPort& port;
+            Req request;
+            std::uint32_t tick;
+
+            Awaiter(AsyncPort& p_port, Req const& p_request, std::uint32_t p_tick)
+                : PendingRequest{Resp::MESSAGE_ID, 0, nullptr, nullptr, nullptr},
+                  port(p_port),
+                  request(p_request),
+                  tick(p_tick)
+            {}
+
+            Awaiter(Awaiter const&) = delete;
+            Awaiter& operator=(Awaiter const&) = delete;
+
+            ~Awaiter()
+            {
+                if (this->registry) {
+                    this->registry->pending.erase(this->correlationId);
+                }
+            }
+
+            bool await_ready() const noexcept { return false; }
+            void await_suspend(std::coroutine_handle<> p_handle)
+            {
+                this->waiter = p_handle;
+                port.send(std::make_unique<EventT<Req>>(request), tick, *this);
+            }
+            std::optional<Resp> await_resume() const
+            {
+                if (not this->response) {
+                    return std::nullopt;
+                }
+                return payload<Resp>(*this->response);
+            }
+        };
+        return Awaiter(*this, p_request, p_tick);
+    }
+
+    void receive(std::unique_ptr<Event> p_response) override
+    {
+        auto& pending = m_registry->pending;
+        auto found = pending.end();
+        if (p_response->isCorrelated()) {
+            found = pending.find(p_response->getCorrelationId());
+        } else {
+            found = pending.begin();
+            while (found != pending.end() and
+                   (found->second->response or found->second->responseId != p_response->getMessageId())) {
+                ++found;
+            }
+        }
+
+        if (found == pending.end() or found->second->response or
+            found->second->responseId != p_response->getMessageId()) {
+            return;
+        }
+
+        found->second->response = std::move(p_response);
+        resumeLater(found->first);
+    }
+
+    // requests sent and not resumed yet
+    std::size_t outstanding() const noexcept { return m_registry->pending.size(); }
+
+private:
+    void resumeLater(std::uint32_t p_correlationId)
+    {
+        m_executor.post([registry = m_registry, p_correlationId] { Registry::resume(*registry, p_correlationId); });
+    }
+
+    void send(std::unique_ptr<Event> p_request, std::uint32_t p_tick, PendingRequest& p_pending)
+    {
+        p_pending.correlationId = m_nextCorrelationId++;
+        p_pending.registry = m_registry.get();
+        p_request->setSequence({m_nextSequenceNumber++, p_tick});
+        p_request->setCorrelationId(p_pending.correlationId);
+        m_registry->pending.emplace(p_pending.correlationId, &p_pending);
+        m_port.send(std::move(p_request));
+    }
+
+    IPort& m_port;
+    LocalExecutor& m_executor;
+    std::shared_ptr<Registry> m_registry;
+
+    std::uint32_t m_nextSequenceNumber = 0;
+    std::uint32_t m_nextCorrelationId = 0;
+};
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <coroutine>
+#include <cstddef>
+#include <deque>
+#include <functional>
+
+// Single-threaded run queue. Nothing runs until run() is called from the owning thread.
+// Work still queued when the executor is destroyed is dropped without running, so posted
+// work may refer to objects that die before the executor. Coroutines suspended on dropped
+// work are never resumed: their owners destroy them, and spawned ones should be run to
+// completion (or their ports destroyed and run() called once more) before the executor goes.
+class LocalExecutor
+{
+public:
+    LocalExecutor() = default;
+
+    LocalExecutor(LocalExecutor const&) = delete;
+    LocalExecutor& operator=(LocalExecutor const&) = delete;
+
+    void post(std::function<void()> p_work) { m_ready.push_back(std::move(p_work)); }
+    void post(std::coroutine_handle<> p_handle) { post([p_handle] { p_handle.resume(); }); }
+
+    auto schedule()
+    {
+        struct Awaiter
+        {
+            LocalExecutor& executor;
+
+            bool await_ready() const noexcept { return false; }
+            void await_suspend(std::coroutine_handle<> p_handle) { executor.post(p_handle); }
+            void await_resume() const noexcept {}
+        };
+        return Awaiter{*this};
+    }
+
+    std::size_t run()
+    {
+        std::size_t executed = 0;
+        while (not m_ready.empty()) {
+            auto work = std::move(m_ready.front());
+            m_ready.pop_front();
+            work();
+            ++executed;
+        }
+        return executed;
+    }
+
+    bool empty() const noexcept { return m_ready.empty(); }
+
+private:
+    std::deque<std::function<void()>> m_ready;
+};
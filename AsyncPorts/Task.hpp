@@ -0,0 +1,134 @@
+#pragma once
+
+#include <coroutine>
+#include <exception>
+#include <optional>
+#include <utility>
+
+#include "LocalExecutor.hpp"
+
+namespace detail
+{
+template <class Promise>
+struct ContinueAwaiter
+{
+    bool await_ready() const noexcept { return false; }
+    std::coroutine_handle<> await_suspend(std::coroutine_handle<Promise> p_handle) noexcept
+    {
+        auto continuation = p_handle.promise().continuation;
+        return continuation ? continuation : std::noop_coroutine();
+    }
+    void await_resume() const noexcept {}
+};
+
+struct PromiseBase
+{
+    std::suspend_always initial_suspend() const noexcept { return {}; }
+    void unhandled_exception() noexcept { error = std::current_exception(); }
+
+    std::coroutine_handle<> continuation;
+    std::exception_ptr error;
+};
+} // namespace detail
+
+// Lazily started coroutine; the awaiting coroutine is resumed when it finishes.
+template <class T = void>
+class Task
+{
+public:
+    struct promise_type : detail::PromiseBase
+    {
+        Task get_return_object() { return Task(std::coroutine_handle<promise_type>::from_promise(*this)); }
+        detail::ContinueAwaiter<promise_type> final_suspend() const noexcept { return {}; }
+        template <class U>
+        void return_value(U&& p_value) { value.emplace(std::forward<U>(p_value)); }
+
+        std::optional<T> value;
+    };
+
+    Task(Task&& p_rhs) noexcept : m_handle(std::exchange(p_rhs.m_handle, nullptr)) {}
+    Task(Task const&) = delete;
+    Task& operator=(Task const&) = delete;
+    ~Task() { if (m_handle) m_handle.destroy(); }
+
+    bool await_ready() const noexcept { return false; }
+    std::coroutine_handle<> await_suspend(std::coroutine_handle<> p_awaiting) noexcept
+    {
+        m_handle.promise().continuation = p_awaiting;
+        return m_handle;
+    }
+    T await_resume()
+    {
+        if (m_handle.promise().error) {
+            std::rethrow_exception(m_handle.promise().error);
+        }
+        return std::move(*m_handle.promise().value);
+    }
+
+private:
+    explicit Task(std::coroutine_handle<promise_type> p_handle) : m_handle(p_handle) {}
+
+    std::coroutine_handle<promise_type> m_handle;
+};
+
+template <>
+class Task<void>
+{
+public:
+    struct promise_type : detail::PromiseBase
+    {
+        Task get_return_object() { return Task(std::coroutine_handle<promise_type>::from_promise(*this)); }
+        detail::ContinueAwaiter<promise_type> final_suspend() const noexcept { return {}; }
+        void return_void() const noexcept {}
+    };
+
+    Task(Task&& p_rhs) noexcept : m_handle(std::exchange(p_rhs.m_handle, nullptr)) {}
+    Task(Task const&) = delete;
+    Task& operator=(Task const&) = delete;
+    ~Task() { if (m_handle) m_handle.destroy(); }
+
+    bool await_ready() const noexcept { return false; }
+    std::coroutine_handle<> await_suspend(std::coroutine_handle<> p_awaiting) noexcept
+    {
+        m_handle.promise().continuation = p_awaiting;
+        return m_handle;
+    }
+    void await_resume()
+    {
+        if (m_handle.promise().error) {
+            std::rethrow_exception(m_handle.promise().error);
+        }
+    }
+
+private:
+    explicit Task(std::coroutine_handle<promise_type> p_handle) : m_handle(p_handle) {}
+
+    std::coroutine_handle<promise_type> m_handle;
+};
+
+namespace detail
+{
+struct Detached
+{
+    struct promise_type
+    {
+        Detached get_return_object() const noexcept { return {}; }
+        std::suspend_never initial_suspend() const noexcept { return {}; }
+        std::suspend_never final_suspend() const noexcept { return {}; }
+        void return_void() const noexcept {}
+        void unhandled_exception() const noexcept { std::terminate(); }
+    };
+};
+
+inline Detached runDetached(LocalExecutor& p_executor, Task<> p_task)
+{
+    co_await p_executor.schedule();
+    co_await std::move(p_task);
+}
+} // namespace detail
+
+// Queues the task on the executor; it owns itself until it finishes. Exceptions escaping it terminate.
+inline void spawn(LocalExecutor& p_executor, Task<> p_task)
+{
+    detail::runDetached(p_executor, std::move(p_task));
+}
@@ -3,6 +3,17 @@
 #include <cstdint>
 #include <memory>
 
+// Stamped by the sender of an event stream.
+struct EventSequence
+{
+    // Position of the event in the stream its sender delivers to one receiver, counted from 0.
+    // Receivers restoring order (Snake::Controller's reorder window) rely on it; it does not
+    // tell which request a response answers.
+    std::uint32_t number;
+    // Game tick the event belongs to; a response carries the tick of the request it answers.
+    std::uint32_t tick;
+};
+
 class Event
 {
 public:
@@ -10,4 +21,30 @@ public:
 
     virtual std::uint32_t getMessageId() const = 0;
     virtual std::unique_ptr<Event> clone() const  = 0;
+
+    bool isSequenced() const noexcept { return m_sequenced; }
+    EventSequence getSequence() const noexcept { return m_sequence; }
+
+    void setSequence(EventSequence const& p_sequence) noexcept
+    {
+        m_sequence = p_sequence;
+        m_sequenced = true;
+    }
+
+    // Set on a request by its sender and copied unchanged into the response, independently
+    // of the sequence each of them carries in its own stream.
+    bool isCorrelated() const noexcept { return m_correlated; }
+    std::uint32_t getCorrelationId() const noexcept { return m_correlationId; }
+
+    void setCorrelationId(std::uint32_t p_correlationId) noexcept
+    {
+        m_correlationId = p_correlationId;
+        m_correlated = true;
+    }
+
+private:
+    EventSequence m_sequence = {0, 0};
+    bool m_sequenced = false;
+    std::uint32_t m_correlationId = 0;
+    bool m_correlated = false;
 };
@@ -10,11 +10,11 @@ class EventT : public Event
     static_assert(std::is_copy_constructible<T>::value, "Payload type must be copy-construcible!");
 public:
     EventT(T const& payload = T())
-        : m_payload(std::make_unique<T>(payload))
+        : m_payload(payload)
     {}
 
     EventT(T&& payload)
-        : m_payload(std::make_unique<T>(std::forward<T>(payload)))
+        : m_payload(std::forward<T>(payload))
     {}
 
     EventT(EventT&&) = default;
@@ -23,16 +23,26 @@ public:
     EventT& operator=(EventT<T> const&) = delete;
 
     std::uint32_t getMessageId() const override { return T::MESSAGE_ID; };
-    std::unique_ptr<Event> clone() const override { return std::make_unique<EventT<T>>(*m_payload); }
-
-    T * const operator->() noexcept { return m_payload.get(); }
-    T const * const operator->() const noexcept { return m_payload.get(); }
-
-    T& operator*() noexcept { return *m_payload; }
-    T const& operator*() const noexcept { return *m_payload; }
+    std::unique_ptr<Event> clone() const override
+    {
+        auto l_clone = std::make_unique<EventT<T>>(m_payload);
+        if (isSequenced()) {
+            l_clone->setSequence(getSequence());
+        }
+        if (isCorrelated()) {
+            l_clone->setCorrelationId(getCorrelationId());
+        }
+        return l_clone;
+    }
+
+    T * const operator->() noexcept { return &m_payload; }
+    T const * const operator->() const noexcept { return &m_payload; }
+
+    T& operator*() noexcept { return m_payload; }
+    T const& operator*() const noexcept { return m_payload; }
 
 private:
-    std::unique_ptr<T> m_payload;
+    T m_payload;
 };
 
 template <class T>
@@ -0,0 +1,209 @@
+#include "ArenaController.hpp"
+
+#include <sstream>
+
+#include "EventT.hpp"
+#include "GameState.hpp"
+#include "IPort.hpp"
+#include "SnakeController.hpp"
+
+namespace Snake
+{
+constexpr std::int32_t ArenaController::FREE_CELL;
+constexpr std::int32_t ArenaController::FOOD_CELL;
+
+ArenaController::ArenaController(IPort& p_displayPort, IPort& p_foodPort, IPort& p_scorePort, std::string const& p_config)
+    : m_displayPort(p_displayPort),
+      m_foodPort(p_foodPort),
+      m_scorePort(p_scorePort)
+{
+    std::istringstream istr(p_config);
+    char w = 0, f = 0, p = 0;
+    int width = 0, height = 0, foods = 0, players = 0;
+
+    istr >> w >> width >> height >> f >> foods;
+    if (w != 'W' or f != 'F' or width <= 0 or height <= 0 or foods < 0) {
+        throw ConfigurationError();
+    }
+
+    m_mapDimension = std::make_pair(width, height);
+    m_occupancy.assign(static_cast<std::size_t>(width) * height, FREE_CELL);
+    m_headClaims.assign(m_occupancy.size(), HeadClaim{0, 0});
+
+    while (foods--) {
+        Segment food;
+        if (not (istr >> food.x >> food.y) or not isOnMap(food)) {
+            throw ConfigurationError();
+        }
+        m_occupancy[cellIndex(food)] = FOOD_CELL;
+    }
+
+    istr >> p >> players;
+    if (p != 'P' or players < 0) {
+        throw ConfigurationError();
+    }
+
+    std::vector<Segment> segments;
+    for (std::uint32_t index = 0; index < static_cast<std::uint32_t>(players); ++index) {
+        char d = 0;
+        int id = 0, length = 0;
+        if (not (istr >> id >> d >> length) or length <= 0 or
+            not m_playerIndices.emplace(id, index).second) {
+            throw ConfigurationError();
+        }
+
+        segments.clear();
+        while (length--) {
+            Segment seg;
+            if (not (istr >> seg.x >> seg.y) or not isOnMap(seg) or m_occupancy[cellIndex(seg)] != FREE_CELL) {
+                throw ConfigurationError();
+            }
+            m_occupancy[cellIndex(seg)] = index + 1;
+            segments.push_back(seg);
+        }
+
+        Player player{id, parseDirection(d), Body(m_mapDimension), true};
+        for (auto it = segments.rbegin(); it != segments.rend(); ++it) {
+            player.body.pushHead(*it);
+        }
+        m_players.push_back(std::move(player));
+    }
+
+    m_newHeads.resize(m_players.size());
+    m_dying.resize(m_players.size());
+}
+
+void ArenaController::receive(std::unique_ptr<Event> e)
+{
+    switch (e->getMessageId()) {
+        case TimeoutInd::MESSAGE_ID:
+            handleTimeout();
+            break;
+        case DirectionInd::MESSAGE_ID:
+            handleDirection(payload<DirectionInd>(*e));
+            break;
+        case FoodResp::MESSAGE_ID:
+            handleFoodResp(payload<FoodResp>(*e));
+            break;
+        default:
+            throw UnexpectedEventException();
+    }
+}
+
+bool ArenaController::isOnMap(Segment const& p_segment) const
+{
+    return p_segment.x >= 0 and p_segment.y >= 0 and
+           p_segment.x < m_mapDimension.first and p_segment.y < m_mapDimension.second;
+}
+
+std::size_t ArenaController::cellIndex(Segment const& p_segment) const
+{
+    return static_cast<std::size_t>(p_segment.y) * m_mapDimension.first + p_segment.x;
+}
+
+void ArenaController::display(Segment const& p_segment, Cell p_value)
+{
+    DisplayInd l_evt;
+    l_evt.x = p_segment.x;
+    l_evt.y = p_segment.y;
+    l_evt.value = p_value;
+
+    m_displayPort.send(std::make_unique<EventT<DisplayInd>>(l_evt));
+}
+
+void ArenaController::handleTimeout()
+{
+    ++m_tick;
+
+    for (std::uint32_t index = 0; index < m_players.size(); ++index) {
+        auto const& player = m_players[index];
+        if (not player.alive) {
+            continue;
+        }
+
+        auto const head = nextHead(player.body.head(), player.direction);
+        m_newHeads[index] = head;
+        m_dying[index] = not isOnMap(head) or m_occupancy[cellIndex(head)] > FREE_CELL;
+
+        if (not m_dying[index]) {
+            auto& claim = m_headClaims[cellIndex(head)];
+            if (claim.tick == m_tick) {
+                m_dying[claim.player] = true;
+                m_dying[index] = true;
+            } else {
+                claim = HeadClaim{m_tick, index};
+            }
+        }
+    }
+
+    for (std::uint32_t index = 0; index < m_players.size(); ++index) {
+        auto& player = m_players[index];
+        if (not player.alive) {
+            continue;
+        }
+
+        if (m_dying[index]) {
+            LooseInd looseInd;
+            looseInd.playerId = player.id;
+            m_scorePort.send(std::make_unique<EventT<LooseInd>>(looseInd));
+            removePlayer(index);
+            continue;
+        }
+
+        auto const head = m_newHeads[index];
+        auto& cell = m_occupancy[cellIndex(head)];
+
+        if (cell == FOOD_CELL) {
+            ScoreInd scoreInd;
+            scoreInd.playerId = player.id;
+            m_scorePort.send(std::make_unique<EventT<ScoreInd>>(scoreInd));
+            m_foodPort.send(std::make_unique<EventT<FoodReq>>());
+        } else {
+            auto const tail = player.body.popTail();
+            m_occupancy[cellIndex(tail)] = FREE_CELL;
+            display(tail, Cell_FREE);
+        }
+
+        cell = index + 1;
+        player.body.pushHead(head);
+        display(head, Cell_SNAKE);
+    }
+}
+
+void ArenaController::removePlayer(std::uint32_t p_index)
+{
+    auto& player = m_players[p_index];
+    while (not player.body.empty()) {
+        auto const segment = player.body.popTail();
+        m_occupancy[cellIndex(segment)] = FREE_CELL;
+        display(segment, Cell_FREE);
+    }
+    player.alive = false;
+}
+
+void ArenaController::handleDirection(DirectionInd const& p_direction)
+{
+    auto const found = m_playerIndices.find(p_direction.playerId);
+    if (found == m_playerIndices.end()) {
+        return;
+    }
+
+    auto& player = m_players[found->second];
+    if ((player.direction & 0b01) != (p_direction.direction & 0b01)) {
+        player.direction = p_direction.direction;
+    }
+}
+
+void ArenaController::handleFoodResp(FoodResp const& p_food)
+{
+    Segment const food{p_food.x, p_food.y};
+
+    if (not isOnMap(food) or m_occupancy[cellIndex(food)] != FREE_CELL) {
+        m_foodPort.send(std::make_unique<EventT<FoodReq>>());
+    } else {
+        m_occupancy[cellIndex(food)] = FOOD_CELL;
+        display(food, Cell_FOOD);
+    }
+}
+
+} // namespace Snake
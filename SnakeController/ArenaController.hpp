@@ -0,0 +1,81 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "IEventHandler.hpp"
+#include "SnakeBody.hpp"
+#include "SnakeInterface.hpp"
+
+class Event;
+class IPort;
+
+namespace Snake
+{
+// Many snakes sharing one board and one food set. Configuration:
+//   W <width> <height> F <foods> (<x> <y>)... P <players> (<id> <U|D|L|R> <length> (<x> <y>)...)...
+// with each body listed from head to tail. Every TimeoutInd moves all living snakes at once:
+// a snake dies when its new head leaves the board, hits any body (tails included, as they
+// vacate only after the move) or meets another new head. Dead snakes are removed from the board.
+// DirectionInd is routed by playerId, FoodResp adds a food to the set; FoodInd is not supported.
+class ArenaController : public IEventHandler
+{
+public:
+    ArenaController(IPort& p_displayPort, IPort& p_foodPort, IPort& p_scorePort, std::string const& p_config);
+
+    ArenaController(ArenaController const& p_rhs) = delete;
+    ArenaController& operator=(ArenaController const& p_rhs) = delete;
+
+    void receive(std::unique_ptr<Event> e) override;
+
+private:
+    struct Player
+    {
+        int id;
+        Direction direction;
+        Body body;
+        bool alive;
+    };
+
+    struct HeadClaim
+    {
+        std::uint32_t tick;
+        std::uint32_t player;
+    };
+
+    static constexpr std::int32_t FREE_CELL = 0;
+    static constexpr std::int32_t FOOD_CELL = -1;
+
+    void handleTimeout();
+    void handleDirection(DirectionInd const& p_direction);
+    void handleFoodResp(FoodResp const& p_food);
+
+    void removePlayer(std::uint32_t p_index);
+    void display(Segment const& p_segment, Cell p_value);
+
+    bool isOnMap(Segment const& p_segment) const;
+    std::size_t cellIndex(Segment const& p_segment) const;
+
+    IPort& m_displayPort;
+    IPort& m_foodPort;
+    IPort& m_scorePort;
+
+    std::pair<int, int> m_mapDimension;
+
+    std::vector<Player> m_players;
+    std::unordered_map<int, std::uint32_t> m_playerIndices;
+
+    // FREE_CELL, FOOD_CELL or index of occupying player + 1
+    std::vector<std::int32_t> m_occupancy;
+    std::vector<HeadClaim> m_headClaims;
+    std::uint32_t m_tick = 0;
+
+    std::vector<Segment> m_newHeads;
+    std::vector<char> m_dying;
+};
+
+} // namespace Snake
@@ -0,0 +1,17 @@
+#include "AsyncFood.hpp"
+
+#include "SnakeInterface.hpp"
+
+namespace Snake
+{
+Task<std::optional<std::pair<int, int>>> requestFood(AsyncPort& p_foodPort, GameState const& p_state)
+{
+    while (auto const food = co_await p_foodPort.request<FoodReq, FoodResp>()) {
+        if (not p_state.collidesWithSnake(food->x, food->y)) {
+            co_return std::make_pair(food->x, food->y);
+        }
+    }
+    co_return std::nullopt;
+}
+
+} // namespace Snake
@@ -0,0 +1,22 @@
+#pragma once
+
+#include <optional>
+#include <utility>
+
+#include "AsyncPort.hpp"
+#include "GameState.hpp"
+#include "Task.hpp"
+
+namespace Snake
+{
+// Requests food positions until one does not collide with the snake. Yields std::nullopt
+// when the food port is destroyed before a usable position arrived. Only the returned
+// task owns the state of the exchange, so any number of games may have requests in flight.
+// p_state must outlive the task.
+//
+// This is a standalone layer for hosts that drive GameState directly. Snake::Controller
+// stays C++14 and event driven: it still sends FoodReq and retries on colliding FoodResp
+// from receive().
+Task<std::optional<std::pair<int, int>>> requestFood(AsyncPort& p_foodPort, GameState const& p_state);
+
+} // namespace Snake
@@ -0,0 +1,62 @@
+#include "AsyncFood.hpp"
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+#include "FoodServiceStub.hpp"
+
+using namespace Snake;
+
+namespace
+{
+Task<> feed(AsyncPort& p_foodPort, GameState& p_state, std::size_t p_rounds, std::size_t& p_placed)
+{
+    for (std::size_t round = 0; round < p_rounds; ++round) {
+        auto const food = co_await requestFood(p_foodPort, p_state);
+        if (not food) {
+            co_return;
+        }
+        p_state.placeFood(*food);
+        ++p_placed;
+    }
+}
+} // namespace
+
+// Usage: SnakeController_FoodBench [games] [rounds]
+// Every game keeps one food request outstanding; every third answer collides with the snake.
+int main(int argc, char* argv[])
+{
+    std::size_t const games = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 10000;
+    std::size_t const rounds = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 10;
+    if (0 == games or 0 == rounds) {
+        std::cerr << "Usage: " << argv[0] << " [games > 0] [rounds > 0]\n";
+        return 1;
+    }
+
+    Body body(std::make_pair(1000, 1000));
+    for (int x = 0; x < 100; ++x) {
+        body.pushHead(Segment{x, 0});
+    }
+    GameState const state(std::make_pair(1000, 1000), std::make_pair(500, 500), Direction_RIGHT, body);
+    std::vector<GameState> states(games, state);
+
+    LocalExecutor executor;
+    FoodServiceStub service(executor, {{10, 0}, {10, 10}, {20, 20}});
+    AsyncPort foodPort(service, executor);
+    service.connect(foodPort);
+
+    std::size_t placed = 0;
+    auto const start = std::chrono::steady_clock::now();
+    for (std::size_t i = 0; i < games; ++i) {
+        spawn(executor, feed(foodPort, states[i], rounds, placed));
+    }
+    executor.run();
+    auto const elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    std::cout << "games: " << games << ", food placed: " << placed << ", requests: " << service.served()
+              << ", max outstanding: " << service.maxInFlight << '\n'
+              << "total: " << elapsed * 1e3 << " ms, per request: " << elapsed * 1e9 / service.served() << " ns\n";
+    return placed == games * rounds ? 0 : 1;
+}
@@ -0,0 +1,73 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "EventT.hpp"
+#include "IEventHandler.hpp"
+#include "IPort.hpp"
+#include "LocalExecutor.hpp"
+#include "SnakeInterface.hpp"
+
+namespace Snake
+{
+
+// In-process stand-in for the food service: answers every FoodReq with the next of the given
+// positions (cycling). An answer carries the request's correlation id and tick, and is numbered
+// in the stub's own delivery order. Answers are delivered through the executor.
+class FoodServiceStub : public IPort
+{
+public:
+    FoodServiceStub(LocalExecutor& p_executor, std::vector<std::pair<int, int>> p_positions)
+        : m_executor(p_executor),
+          m_positions(std::move(p_positions))
+    {}
+
+    void connect(IEventHandler& p_client) { m_client = &p_client; }
+
+    void send(std::unique_ptr<Event> p_request) override
+    {
+        FoodResp l_resp;
+        l_resp.x = m_positions[m_served % m_positions.size()].first;
+        l_resp.y = m_positions[m_served % m_positions.size()].second;
+        ++m_served;
+
+        auto l_evt = std::make_unique<EventT<FoodResp>>(l_resp);
+        if (p_request->isSequenced()) {
+            l_evt->setSequence({m_nextSequenceNumber++, p_request->getSequence().tick});
+        }
+        if (p_request->isCorrelated()) {
+            l_evt->setCorrelationId(p_request->getCorrelationId());
+        }
+
+        m_responses.push_back(std::move(l_evt));
+        maxInFlight = std::max(maxInFlight, m_responses.size());
+        m_executor.post([this] { deliverNext(); });
+    }
+
+    std::size_t served() const noexcept { return m_served; }
+
+    std::size_t maxInFlight = 0;
+
+private:
+    void deliverNext()
+    {
+        auto l_evt = std::move(m_responses.front());
+        m_responses.pop_front();
+        m_client->receive(std::move(l_evt));
+    }
+
+    LocalExecutor& m_executor;
+    std::vector<std::pair<int, int>> m_positions;
+    IEventHandler* m_client = nullptr;
+    std::size_t m_served = 0;
+    std::uint32_t m_nextSequenceNumber = 0;
+    std::deque<std::unique_ptr<Event>> m_responses;
+};
+
+} // namespace Snake
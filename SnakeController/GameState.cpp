@@ -0,0 +1,64 @@
+#include "GameState.hpp"
+
+namespace Snake
+{
+Segment nextHead(Segment const& p_head, Direction p_direction)
+{
+    Segment head;
+    head.x = p_head.x + ((p_direction & 0b01) ? (p_direction & 0b10) ? 1 : -1 : 0);
+    head.y = p_head.y + (not (p_direction & 0b01) ? (p_direction & 0b10) ? 1 : -1 : 0);
+    return head;
+}
+
+GameState::GameState(std::pair<int, int> const& p_mapDimension,
+                     std::pair<int, int> const& p_foodPosition,
+                     Direction p_direction,
+                     Body p_body)
+    : m_mapDimension(p_mapDimension),
+      m_foodPosition(p_foodPosition),
+      m_currentDirection(p_direction),
+      m_body(std::move(p_body))
+{}
+
+StepResult GameState::step()
+{
+    StepResult result;
+    result.head = nextHead(m_body.head(), m_currentDirection);
+    result.freedTail = m_body.tail();
+
+    if (m_body.contains(result.head)) {
+        result.outcome = StepOutcome_LOST;
+    } else if (std::make_pair(result.head.x, result.head.y) == m_foodPosition) {
+        result.outcome = StepOutcome_ATE;
+        m_body.pushHead(result.head);
+    } else if (result.head.x < 0 or result.head.y < 0 or
+               result.head.x >= m_mapDimension.first or
+               result.head.y >= m_mapDimension.second) {
+        result.outcome = StepOutcome_LOST;
+    } else {
+        result.outcome = StepOutcome_MOVED;
+        m_body.popTail();
+        m_body.pushHead(result.head);
+    }
+
+    return result;
+}
+
+void GameState::turn(Direction p_direction)
+{
+    if ((m_currentDirection & 0b01) != (p_direction & 0b01)) {
+        m_currentDirection = p_direction;
+    }
+}
+
+void GameState::placeFood(std::pair<int, int> const& p_foodPosition)
+{
+    m_foodPosition = p_foodPosition;
+}
+
+bool GameState::collidesWithSnake(int p_x, int p_y) const
+{
+    return m_body.contains(Segment{p_x, p_y});
+}
+
+} // namespace Snake
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <utility>
+
+#include "SnakeBody.hpp"
+#include "SnakeInterface.hpp"
+
+namespace Snake
+{
+enum StepOutcome
+{
+    StepOutcome_MOVED,
+    StepOutcome_ATE,
+    StepOutcome_LOST
+};
+
+struct StepResult
+{
+    StepOutcome outcome;
+    Segment head;
+    Segment freedTail;
+};
+
+Segment nextHead(Segment const& p_head, Direction p_direction);
+
+// Value type holding the whole game. Copies are cheap (the body is shared until
+// modified), so a game can be forked to try moves ahead without touching any port.
+// Forks may be stepped on different threads; one GameState is not itself thread-safe.
+class GameState
+{
+public:
+    GameState(std::pair<int, int> const& p_mapDimension,
+              std::pair<int, int> const& p_foodPosition,
+              Direction p_direction,
+              Body p_body);
+
+    StepResult step();
+    void turn(Direction p_direction);
+    void placeFood(std::pair<int, int> const& p_foodPosition);
+
+    bool collidesWithSnake(int p_x, int p_y) const;
+
+    std::pair<int, int> const& mapDimension() const noexcept { return m_mapDimension; }
+    std::pair<int, int> const& foodPosition() const noexcept { return m_foodPosition; }
+    Direction direction() const noexcept { return m_currentDirection; }
+    Body const& body() const noexcept { return m_body; }
+
+private:
+    std::pair<int, int> m_mapDimension;
+    std::pair<int, int> m_foodPosition;
+
+    Direction m_currentDirection;
+    Body m_body;
+};
+
+} // namespace Snake
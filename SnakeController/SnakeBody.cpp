@@ -0,0 +1,174 @@
+#include "SnakeBody.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <limits>
+
+namespace Snake
+{
+Body::Body()
+    : Body(true)
+{}
+
+Body::Body(std::pair<int, int> const& p_mapDimension)
+    : Body(p_mapDimension.first - 1 <= std::numeric_limits<std::int16_t>::max() and
+           p_mapDimension.second - 1 <= std::numeric_limits<std::int16_t>::max())
+{}
+
+Body::Body(bool p_packed)
+    : m_sealed(std::make_shared<SealedChunks>()),
+      m_packed(p_packed)
+{}
+
+bool Body::fitsPacked(Segment const& p_segment) noexcept
+{
+    return p_segment.x >= std::numeric_limits<std::int16_t>::min() and
+           p_segment.x <= std::numeric_limits<std::int16_t>::max() and
+           p_segment.y >= std::numeric_limits<std::int16_t>::min() and
+           p_segment.y <= std::numeric_limits<std::int16_t>::max();
+}
+
+std::uint32_t Body::pack(Segment const& p_segment) noexcept
+{
+    return static_cast<std::uint16_t>(p_segment.x) | static_cast<std::uint32_t>(static_cast<std::uint16_t>(p_segment.y)) << 16;
+}
+
+Body::Chunk const& Body::chunkAt(std::size_t p_position) const
+{
+    auto const chunk = m_firstChunk + p_position / segmentsPerChunk();
+    return chunk < m_sealedEnd ? *(*m_sealed)[chunk] : *m_head;
+}
+
+Segment Body::load(Chunk const& p_chunk, std::size_t p_slot) const
+{
+    if (m_packed) {
+        return Segment{static_cast<std::int16_t>(p_chunk.words[p_slot] & 0xFFFF),
+                       static_cast<std::int16_t>(p_chunk.words[p_slot] >> 16)};
+    }
+    return Segment{static_cast<int>(p_chunk.words[2 * p_slot]), static_cast<int>(p_chunk.words[2 * p_slot + 1])};
+}
+
+Segment Body::head() const
+{
+    assert(not empty());
+    auto const position = m_tailOffset + m_size - 1;
+    return load(chunkAt(position), position % segmentsPerChunk());
+}
+
+Segment Body::tail() const
+{
+    assert(not empty());
+    return load(chunkAt(m_tailOffset), m_tailOffset);
+}
+
+bool Body::contains(Segment const& p_segment) const
+{
+    if (m_packed and not fitsPacked(p_segment)) {
+        return false;
+    }
+
+    auto const key = pack(p_segment);
+    auto const perChunk = segmentsPerChunk();
+    auto position = m_tailOffset;
+    auto remaining = m_size;
+
+    for (auto chunk = m_firstChunk; remaining; ++chunk) {
+        auto const& words = (chunk < m_sealedEnd ? (*m_sealed)[chunk] : m_head)->words;
+        auto const end = std::min(perChunk, position + remaining);
+        remaining -= end - position;
+
+        if (m_packed) {
+            for (; position < end; ++position) {
+                if (words[position] == key) {
+                    return true;
+                }
+            }
+        } else {
+            for (; position < end; ++position) {
+                if (static_cast<int>(words[2 * position]) == p_segment.x and
+                    static_cast<int>(words[2 * position + 1]) == p_segment.y) {
+                    return true;
+                }
+            }
+        }
+        position = 0;
+    }
+    return false;
+}
+
+void Body::widen()
+{
+    Body wide(false);
+    for (std::size_t i = 0; i < m_size; ++i) {
+        auto const position = m_tailOffset + i;
+        wide.pushHead(load(chunkAt(position), position % segmentsPerChunk()));
+    }
+    *this = std::move(wide);
+}
+
+void Body::seal()
+{
+    auto& sealed = *m_sealed;
+
+    if (m_sealed.use_count() > 1) {
+        // other copies may be reading the shared list, possibly on other threads
+        m_sealed = std::make_shared<SealedChunks>(sealed.begin() + m_firstChunk, sealed.begin() + m_sealedEnd);
+        m_sealedEnd -= m_firstChunk;
+        m_firstChunk = 0;
+    } else if (m_firstChunk * 2 >= sealed.size()) {
+        sealed.erase(sealed.begin(), sealed.begin() + m_firstChunk);
+        m_sealedEnd -= m_firstChunk;
+        m_firstChunk = 0;
+    }
+
+    m_sealed->push_back(std::move(m_head));
+    ++m_sealedEnd;
+}
+
+void Body::pushHead(Segment const& p_segment)
+{
+    if (m_packed and not fitsPacked(p_segment)) {
+        widen();
+    }
+
+    if (not m_head) {
+        m_head = m_spare.use_count() == 1 ? std::move(m_spare) : std::make_shared<Chunk>();
+        m_spare.reset();
+    } else if (m_head.use_count() > 1) {
+        m_head = std::make_shared<Chunk>(*m_head);
+    }
+
+    auto const slot = (m_tailOffset + m_size) % segmentsPerChunk();
+    if (m_packed) {
+        m_head->words[slot] = pack(p_segment);
+    } else {
+        m_head->words[2 * slot] = static_cast<std::uint32_t>(p_segment.x);
+        m_head->words[2 * slot + 1] = static_cast<std::uint32_t>(p_segment.y);
+    }
+    ++m_size;
+
+    if (slot + 1 == segmentsPerChunk()) {
+        seal();
+    }
+}
+
+Segment Body::popTail()
+{
+    auto const segment = tail();
+
+    --m_size;
+    if (++m_tailOffset == segmentsPerChunk()) {
+        if (m_sealed.use_count() == 1) {
+            auto& consumed = (*m_sealed)[m_firstChunk];
+            if (consumed.use_count() == 1) {
+                m_spare = std::move(consumed);
+            }
+            consumed.reset();
+        }
+        ++m_firstChunk;
+        m_tailOffset = 0;
+    }
+    return segment;
+}
+
+} // namespace Snake
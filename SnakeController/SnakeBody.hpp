@@ -0,0 +1,82 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace Snake
+{
+struct Segment
+{
+    int x;
+    int y;
+};
+
+inline bool operator==(Segment const& p_lhs, Segment const& p_rhs)
+{
+    return p_lhs.x == p_rhs.x and p_lhs.y == p_rhs.y;
+}
+
+// Persistent queue of segments ordered from tail to head, stored in fixed-size chunks.
+// Full chunks are sealed into a list of chunk pointers shared by copies, so copying a Body
+// is O(1) and a step of a copy only clones the open head chunk it writes to. Nothing shared
+// is ever written: a copy that seals a chunk while the list is shared first copies the
+// list (one pointer per sealed chunk). Distinct copies may therefore be used on different
+// threads; a single Body must not be used from two threads at once.
+//
+// Segments are packed into one 16-bit x/y word each when the map allows it and
+// take two words otherwise. A packed body that is given a segment out of the
+// 16-bit range is converted once to the wide layout.
+class Body
+{
+public:
+    Body();
+    explicit Body(std::pair<int, int> const& p_mapDimension);
+
+    std::size_t size() const noexcept { return m_size; }
+    bool empty() const noexcept { return 0 == m_size; }
+    bool isPacked() const noexcept { return m_packed; }
+
+    Segment head() const;
+    Segment tail() const;
+    bool contains(Segment const& p_segment) const;
+
+    void pushHead(Segment const& p_segment);
+    Segment popTail();
+
+private:
+    static constexpr std::size_t CHUNK_WORDS = 128;
+
+    struct Chunk
+    {
+        std::array<std::uint32_t, CHUNK_WORDS> words;
+    };
+
+    using SealedChunks = std::vector<std::shared_ptr<Chunk>>;
+
+    explicit Body(bool p_packed);
+
+    static bool fitsPacked(Segment const& p_segment) noexcept;
+    static std::uint32_t pack(Segment const& p_segment) noexcept;
+
+    std::size_t segmentsPerChunk() const noexcept { return m_packed ? CHUNK_WORDS : CHUNK_WORDS / 2; }
+    Chunk const& chunkAt(std::size_t p_position) const;
+    Segment load(Chunk const& p_chunk, std::size_t p_slot) const;
+
+    void seal();
+    void widen();
+
+    std::shared_ptr<SealedChunks> m_sealed;
+    std::size_t m_firstChunk = 0;
+    std::size_t m_sealedEnd = 0;
+    std::shared_ptr<Chunk> m_head;
+    std::shared_ptr<Chunk> m_spare;
+    std::size_t m_tailOffset = 0;
+    std::size_t m_size = 0;
+    bool m_packed;
+};
+
+} // namespace Snake
@@ -1,6 +1,5 @@
 #include "SnakeController.hpp"
 
-#include <algorithm>
 #include <sstream>
 
 #include "EventT.hpp"
@@ -16,10 +15,25 @@ UnexpectedEventException::UnexpectedEventException()
     : std::runtime_error("Unexpected event received!")
 {}
 
-Controller::Controller(IPort& p_displayPort, IPort& p_foodPort, IPort& p_scorePort, std::string const& p_config)
-    : m_displayPort(p_displayPort),
-      m_foodPort(p_foodPort),
-      m_scorePort(p_scorePort)
+Direction parseDirection(char p_letter)
+{
+    switch (p_letter) {
+        case 'U':
+            return Direction_UP;
+        case 'D':
+            return Direction_DOWN;
+        case 'L':
+            return Direction_LEFT;
+        case 'R':
+            return Direction_RIGHT;
+        default:
+            throw ConfigurationError();
+    }
+}
+
+namespace
+{
+GameState parseConfig(std::string const& p_config)
 {
     std::istringstream istr(p_config);
     char w, f, s, d;
@@ -29,166 +43,164 @@ Controller::Controller(IPort& p_displayPort, IPort& p_foodPort, IPort& p_scorePo
     istr >> w >> width >> height >> f >> foodX >> foodY >> s;
 
     if (w == 'W' and f == 'F' and s == 'S') {
-        m_mapDimension = std::make_pair(width, height);
-        m_foodPosition = std::make_pair(foodX, foodY);
-
         istr >> d;
-        switch (d) {
-            case 'U':
-                m_currentDirection = Direction_UP;
-                break;
-            case 'D':
-                m_currentDirection = Direction_DOWN;
-                break;
-            case 'L':
-                m_currentDirection = Direction_LEFT;
-                break;
-            case 'R':
-                m_currentDirection = Direction_RIGHT;
-                break;
-            default:
-                throw ConfigurationError();
-        }
+        auto const direction = parseDirection(d);
         istr >> length;
 
-        while (length) {
+        std::vector<Segment> segments;
+        while (length--) {
             Segment seg;
             istr >> seg.x >> seg.y;
-            seg.ttl = length--;
 
-            m_segments.push_back(seg);
+            segments.push_back(seg);
+        }
+
+        Body body(std::make_pair(width, height));
+        for (auto it = segments.rbegin(); it != segments.rend(); ++it) {
+            body.pushHead(*it);
         }
+
+        return GameState(std::make_pair(width, height), std::make_pair(foodX, foodY), direction, std::move(body));
     } else {
         throw ConfigurationError();
     }
 }
+} // namespace
+
+Controller::Controller(IPort& p_displayPort, IPort& p_foodPort, IPort& p_scorePort, std::string const& p_config,
+                       std::size_t p_reorderWindow)
+    : m_displayPort(p_displayPort),
+      m_foodPort(p_foodPort),
+      m_scorePort(p_scorePort),
+      m_state(parseConfig(p_config)),
+      m_pendingEvents(p_reorderWindow)
+{}
 
 void Controller::receive(std::unique_ptr<Event> e)
 {
-    try {
-        auto const& timerEvent = *dynamic_cast<EventT<TimeoutInd> const&>(*e);
-
-        Segment const& currentHead = m_segments.front();
+    if (m_pendingEvents.empty() or not e->isSequenced()) {
+        handle(std::move(e));
+    } else {
+        receiveSequenced(std::move(e));
+    }
+}
 
-        Segment newHead;
-        newHead.x = currentHead.x + ((m_currentDirection & 0b01) ? (m_currentDirection & 0b10) ? 1 : -1 : 0);
-        newHead.y = currentHead.y + (not (m_currentDirection & 0b01) ? (m_currentDirection & 0b10) ? 1 : -1 : 0);
-        newHead.ttl = currentHead.ttl;
+void Controller::receiveSequenced(std::unique_ptr<Event> e)
+{
+    auto const window = static_cast<std::uint32_t>(m_pendingEvents.size());
+    auto const number = e->getSequence().number;
 
-        bool lost = false;
+    if (static_cast<std::int32_t>(number - m_nextSequenceNumber) < 0) {
+        return; // duplicate of already handled event or too late to be handled in order
+    }
 
-        for (auto segment : m_segments) {
-            if (segment.x == newHead.x and segment.y == newHead.y) {
-                m_scorePort.send(std::make_unique<EventT<LooseInd>>());
-                lost = true;
-                break;
-            }
+    for (std::uint32_t i = 0; i < window and number - m_nextSequenceNumber >= window; ++i) {
+        auto skipped = std::move(m_pendingEvents[m_nextSequenceNumber++ % window]);
+        if (skipped) {
+            handle(std::move(skipped));
         }
+    }
+    if (number - m_nextSequenceNumber >= window) {
+        m_nextSequenceNumber = number - window + 1;
+    }
 
-        if (not lost) {
-            if (std::make_pair(newHead.x, newHead.y) == m_foodPosition) {
-                m_scorePort.send(std::make_unique<EventT<ScoreInd>>());
-                m_foodPort.send(std::make_unique<EventT<FoodReq>>());
-            } else if (newHead.x < 0 or newHead.y < 0 or
-                       newHead.x >= m_mapDimension.first or
-                       newHead.y >= m_mapDimension.second) {
-                m_scorePort.send(std::make_unique<EventT<LooseInd>>());
-                lost = true;
-            } else {
-                for (auto &segment : m_segments) {
-                    if (not --segment.ttl) {
-                        DisplayInd l_evt;
-                        l_evt.x = segment.x;
-                        l_evt.y = segment.y;
-                        l_evt.value = Cell_FREE;
-
-                        m_displayPort.send(std::make_unique<EventT<DisplayInd>>(l_evt));
-                    }
-                }
-            }
-        }
+    auto& slot = m_pendingEvents[number % window];
+    if (not slot) {
+        slot = std::move(e);
+    }
 
-        if (not lost) {
-            m_segments.push_front(newHead);
-            DisplayInd placeNewHead;
-            placeNewHead.x = newHead.x;
-            placeNewHead.y = newHead.y;
-            placeNewHead.value = Cell_SNAKE;
-
-            m_displayPort.send(std::make_unique<EventT<DisplayInd>>(placeNewHead));
-
-            m_segments.erase(
-                std::remove_if(
-                    m_segments.begin(),
-                    m_segments.end(),
-                    [](auto const& segment){ return not (segment.ttl > 0); }),
-                m_segments.end());
+    handlePendingInOrder();
+}
+
+void Controller::handlePendingInOrder()
+{
+    auto const window = m_pendingEvents.size();
+
+    while (m_pendingEvents[m_nextSequenceNumber % window]) {
+        auto next = std::move(m_pendingEvents[m_nextSequenceNumber++ % window]);
+        handle(std::move(next));
+    }
+}
+
+void Controller::display(int p_x, int p_y, Cell p_value)
+{
+    DisplayInd l_evt;
+    l_evt.x = p_x;
+    l_evt.y = p_y;
+    l_evt.value = p_value;
+
+    m_displayPort.send(std::make_unique<EventT<DisplayInd>>(l_evt));
+}
+
+void Controller::requestFood()
+{
+    auto request = std::make_unique<EventT<FoodReq>>();
+    request->setSequence({m_nextFoodReqNumber++, m_tick});
+    m_lastFoodReqTick = m_tick;
+
+    m_foodPort.send(std::move(request));
+}
+
+void Controller::handleTimeout()
+{
+    ++m_tick;
+    auto const result = m_state.step();
+
+    switch (result.outcome) {
+        case StepOutcome_LOST:
+            m_scorePort.send(std::make_unique<EventT<LooseInd>>());
+            return;
+        case StepOutcome_ATE:
+            m_scorePort.send(std::make_unique<EventT<ScoreInd>>());
+            requestFood();
+            break;
+        case StepOutcome_MOVED:
+            display(result.freedTail.x, result.freedTail.y, Cell_FREE);
+            break;
+    }
+
+    display(result.head.x, result.head.y, Cell_SNAKE);
+}
+
+void Controller::handleFoodPlacement(int p_x, int p_y, bool p_clearOldFood)
+{
+    if (m_state.collidesWithSnake(p_x, p_y)) {
+        requestFood();
+    } else {
+        if (p_clearOldFood) {
+            auto const& oldFood = m_state.foodPosition();
+            display(oldFood.first, oldFood.second, Cell_FREE);
         }
-    } catch (std::bad_cast&) {
-        try {
-            auto direction = dynamic_cast<EventT<DirectionInd> const&>(*e)->direction;
+        display(p_x, p_y, Cell_FOOD);
+    }
 
-            if ((m_currentDirection & 0b01) != (direction & 0b01)) {
-                m_currentDirection = direction;
-            }
-        } catch (std::bad_cast&) {
-            try {
-                auto receivedFood = *dynamic_cast<EventT<FoodInd> const&>(*e);
-
-                bool requestedFoodCollidedWithSnake = false;
-                for (auto const& segment : m_segments) {
-                    if (segment.x == receivedFood.x and segment.y == receivedFood.y) {
-                        requestedFoodCollidedWithSnake = true;
-                        break;
-                    }
-                }
-
-                if (requestedFoodCollidedWithSnake) {
-                    m_foodPort.send(std::make_unique<EventT<FoodReq>>());
-                } else {
-                    DisplayInd clearOldFood;
-                    clearOldFood.x = m_foodPosition.first;
-                    clearOldFood.y = m_foodPosition.second;
-                    clearOldFood.value = Cell_FREE;
-                    m_displayPort.send(std::make_unique<EventT<DisplayInd>>(clearOldFood));
-
-                    DisplayInd placeNewFood;
-                    placeNewFood.x = receivedFood.x;
-                    placeNewFood.y = receivedFood.y;
-                    placeNewFood.value = Cell_FOOD;
-                    m_displayPort.send(std::make_unique<EventT<DisplayInd>>(placeNewFood));
-                }
-
-                m_foodPosition = std::make_pair(receivedFood.x, receivedFood.y);
-
-            } catch (std::bad_cast&) {
-                try {
-                    auto requestedFood = *dynamic_cast<EventT<FoodResp> const&>(*e);
-
-                    bool requestedFoodCollidedWithSnake = false;
-                    for (auto const& segment : m_segments) {
-                        if (segment.x == requestedFood.x and segment.y == requestedFood.y) {
-                            requestedFoodCollidedWithSnake = true;
-                            break;
-                        }
-                    }
-
-                    if (requestedFoodCollidedWithSnake) {
-                        m_foodPort.send(std::make_unique<EventT<FoodReq>>());
-                    } else {
-                        DisplayInd placeNewFood;
-                        placeNewFood.x = requestedFood.x;
-                        placeNewFood.y = requestedFood.y;
-                        placeNewFood.value = Cell_FOOD;
-                        m_displayPort.send(std::make_unique<EventT<DisplayInd>>(placeNewFood));
-                    }
-
-                    m_foodPosition = std::make_pair(requestedFood.x, requestedFood.y);
-                } catch (std::bad_cast&) {
-                    throw UnexpectedEventException();
-                }
+    m_state.placeFood(std::make_pair(p_x, p_y));
+}
+
+void Controller::handle(std::unique_ptr<Event> e)
+{
+    switch (e->getMessageId()) {
+        case TimeoutInd::MESSAGE_ID:
+            handleTimeout();
+            break;
+        case DirectionInd::MESSAGE_ID:
+            m_state.turn(payload<DirectionInd>(*e).direction);
+            break;
+        case FoodInd::MESSAGE_ID: {
+            auto const& receivedFood = payload<FoodInd>(*e);
+            handleFoodPlacement(receivedFood.x, receivedFood.y, true);
+            break;
+        }
+        case FoodResp::MESSAGE_ID: {
+            if (e->isSequenced() and static_cast<std::int32_t>(e->getSequence().tick - m_lastFoodReqTick) < 0) {
+                break; // answers a request older than the last one
             }
+            auto const& requestedFood = payload<FoodResp>(*e);
+            handleFoodPlacement(requestedFood.x, requestedFood.y, false);
+            break;
         }
+        default:
+            throw UnexpectedEventException();
     }
 }
 
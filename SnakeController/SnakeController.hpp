@@ -1,8 +1,11 @@
 #pragma once
 
-#include <list>
 #include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
 
+#include "GameState.hpp"
 #include "IEventHandler.hpp"
 #include "SnakeInterface.hpp"
 
@@ -21,33 +24,49 @@ struct UnexpectedEventException : std::runtime_error
     UnexpectedEventException();
 };
 
+Direction parseDirection(char p_letter);
+
 class Controller : public IEventHandler
 {
 public:
-    Controller(IPort& p_displayPort, IPort& p_foodPort, IPort& p_scorePort, std::string const& p_config);
+    // p_reorderWindow > 0 enables sequenced mode: sequenced events (numbered from 0) are handled
+    // in sequence order, duplicates and events older than the window are dropped, and gaps
+    // are skipped once the window overflows. Unsequenced events are always handled at once.
+    // FoodReq is sent with the current tick (number of TimeoutInd handled); a sequenced FoodResp
+    // must carry the tick of the request it answers and is dropped when older than the last FoodReq.
+    // Its sequence number is its position among the events delivered here, like any other.
+    Controller(IPort& p_displayPort, IPort& p_foodPort, IPort& p_scorePort, std::string const& p_config,
+               std::size_t p_reorderWindow = 0);
 
     Controller(Controller const& p_rhs) = delete;
     Controller& operator=(Controller const& p_rhs) = delete;
 
     void receive(std::unique_ptr<Event> e) override;
 
+    GameState const& state() const noexcept { return m_state; }
+
 private:
-    struct Segment
-    {
-        int x;
-        int y;
-        int ttl;
-    };
+    void handle(std::unique_ptr<Event> e);
+    void receiveSequenced(std::unique_ptr<Event> e);
+    void handlePendingInOrder();
+
+    void handleTimeout();
+    void requestFood();
+    void handleFoodPlacement(int p_x, int p_y, bool p_clearOldFood);
+    void display(int p_x, int p_y, Cell p_value);
 
     IPort& m_displayPort;
     IPort& m_foodPort;
     IPort& m_scorePort;
 
-    std::pair<int, int> m_mapDimension;
-    std::pair<int, int> m_foodPosition;
+    GameState m_state;
+
+    std::uint32_t m_tick = 0;
+    std::uint32_t m_lastFoodReqTick = 0;
+    std::uint32_t m_nextFoodReqNumber = 0;
 
-    Direction m_currentDirection;
-    std::list<Segment> m_segments;
+    std::uint32_t m_nextSequenceNumber = 0;
+    std::vector<std::unique_ptr<Event>> m_pendingEvents;
 };
 
 } // namespace Snake
@@ -18,6 +18,7 @@ struct DirectionInd
     static constexpr std::uint32_t MESSAGE_ID = 0x10;
 
     Direction direction;
+    int playerId;
 };
 
 
@@ -66,11 +67,15 @@ struct FoodResp
 struct ScoreInd
 {
     static constexpr std::uint32_t MESSAGE_ID = 0x70;
+
+    int playerId;
 };
 
 struct LooseInd
 {
     static constexpr std::uint32_t MESSAGE_ID = 0x71;
+
+    int playerId;
 };
 
 } // namespace Snake
@@ -0,0 +1,46 @@
+#include "AllocationCounter.hpp"
+
+#include <cstdlib>
+#include <new>
+
+namespace
+{
+thread_local std::size_t* g_allocationCount = nullptr;
+} // namespace
+
+void* operator new(std::size_t p_size)
+{
+    if (g_allocationCount) {
+        ++*g_allocationCount;
+    }
+    if (void* l_ptr = std::malloc(p_size ? p_size : 1)) {
+        return l_ptr;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* p_ptr) noexcept
+{
+    std::free(p_ptr);
+}
+
+void operator delete(void* p_ptr, std::size_t) noexcept
+{
+    std::free(p_ptr);
+}
+
+namespace Snake
+{
+
+AllocationCounter::AllocationCounter()
+    : m_previous(g_allocationCount)
+{
+    g_allocationCount = &m_count;
+}
+
+AllocationCounter::~AllocationCounter()
+{
+    g_allocationCount = m_previous;
+}
+
+} // namespace Snake
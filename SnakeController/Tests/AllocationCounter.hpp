@@ -0,0 +1,25 @@
+#pragma once
+
+#include <cstddef>
+
+namespace Snake
+{
+
+// Counts calls to the global operator new made by the current thread while alive.
+class AllocationCounter
+{
+public:
+    AllocationCounter();
+    ~AllocationCounter();
+
+    AllocationCounter(AllocationCounter const&) = delete;
+    AllocationCounter& operator=(AllocationCounter const&) = delete;
+
+    std::size_t count() const noexcept { return m_count; }
+
+private:
+    std::size_t m_count = 0;
+    std::size_t* m_previous;
+};
+
+} // namespace Snake
@@ -0,0 +1,154 @@
+#include "ArenaController.hpp"
+#include "SnakeController.hpp"
+
+#include "EventT.hpp"
+
+#include <gtest/gtest.h>
+
+#include "Mocks/PortMock.hpp"
+#include "Mocks/EventMatchers.hpp"
+
+using namespace ::testing;
+
+namespace Snake
+{
+
+struct ArenaTest : Test
+{
+    EventT<TimeoutInd> te;
+
+    StrictMock<PortMock> displayPortMock;
+    StrictMock<PortMock> foodPortMock;
+    StrictMock<PortMock> scorePortMock;
+
+    void configureSUT(std::string p_config)
+    {
+        sut = std::make_unique<ArenaController>(displayPortMock, foodPortMock, scorePortMock, p_config);
+    }
+
+    std::unique_ptr<Event> turn(int p_playerId, Direction p_direction)
+    {
+        DirectionInd l_directionInd;
+        l_directionInd.playerId = p_playerId;
+        l_directionInd.direction = p_direction;
+        return std::make_unique<EventT<DirectionInd>>(l_directionInd);
+    }
+
+    std::unique_ptr<ArenaController> sut = nullptr;
+};
+
+TEST_F(ArenaTest, test_MissingControlLetters_ThrowsException)
+{
+    EXPECT_THROW(configureSUT(""), ConfigurationError);
+    EXPECT_THROW(configureSUT("W 10 10 X 0"), ConfigurationError);
+    EXPECT_THROW(configureSUT("W 10 10 F 0 X 0"), ConfigurationError);
+}
+
+TEST_F(ArenaTest, test_OverlappingSnakes_ThrowsException)
+{
+    EXPECT_THROW(configureSUT("W 10 10 F 0 P 2 1 R 1 5 5 2 L 1 5 5"), ConfigurationError);
+}
+
+TEST_F(ArenaTest, test_SnakeOnFood_ThrowsException)
+{
+    EXPECT_THROW(configureSUT("W 10 10 F 1 5 5 P 1 1 R 1 5 5"), ConfigurationError);
+}
+
+TEST_F(ArenaTest, test_DuplicatedPlayerId_ThrowsException)
+{
+    EXPECT_THROW(configureSUT("W 10 10 F 0 P 2 1 R 1 5 5 1 L 1 6 6"), ConfigurationError);
+}
+
+TEST_F(ArenaTest, test_UnexpectedEvent_ThrowsException)
+{
+    configureSUT("W 10 10 F 0 P 1 1 R 1 5 5");
+    EXPECT_THROW(sut->receive(std::make_unique<EventT<FoodInd>>()), UnexpectedEventException);
+}
+
+TEST_F(ArenaTest, test_AllSnakesMoveInOneTick)
+{
+    configureSUT("W 10 10 F 0 P 2 1 R 2 5 5 4 5 7 U 1 2 2");
+
+    EXPECT_CALL(displayPortMock, send_rvr(DisplayIndEq(4, 5, Cell_FREE)));
+    EXPECT_CALL(displayPortMock, send_rvr(DisplayIndEq(6, 5, Cell_SNAKE)));
+    EXPECT_CALL(displayPortMock, send_rvr(DisplayIndEq(2, 2, Cell_FREE)));
+    EXPECT_CALL(displayPortMock, send_rvr(DisplayIndEq(2, 1, Cell_SNAKE)));
+
+    sut->receive(te.clone());
+}
+
+TEST_F(ArenaTest, test_DirectionIndIsRoutedByPlayerId)
+{
+    configureSUT("W 10 10 F 0 P 2 1 R 1 5 5 7 U 1 2 2");
+
+    sut->receive(turn(7, Direction_LEFT));
+    sut->receive(turn(42, Direction_DOWN));
+
+    EXPECT_CALL(displayPortMock, send_rvr(DisplayIndEq(5, 5, Cell_FREE)));
+    EXPECT_CALL(displayPortMock, send_rvr(DisplayIndEq(6, 5, Cell_SNAKE)));
+    EXPECT_CALL(displayPortMock, send_rvr(DisplayIndEq(2, 2, Cell_FREE)));
+    EXPECT_CALL(displayPortMock, send_rvr(DisplayIndEq(1, 2, Cell_SNAKE)));
+
+    sut->receive(te.clone());
+}
+
+TEST_F(ArenaTest, test_HeadToHeadCollision_BothSnakesLoseAndAreRemoved)
+{
+    configureSUT("W 10 10 F 0 P 3 1 R 1 4 5 2 L 1 6 5 3 U 1 0 9");
+
+    EXPECT_CALL(scorePortMock, send_rvr(LooseIndFor(1)));
+    EXPECT_CALL(scorePortMock, send_rvr(LooseIndFor(2)));
+    EXPECT_CALL(displayPortMock, send_rvr(DisplayIndEq(4, 5, Cell_FREE)));
+    EXPECT_CALL(displayPortMock, send_rvr(DisplayIndEq(6, 5, Cell_FREE)));
+    EXPECT_CALL(displayPortMock, send_rvr(DisplayIndEq(0, 9, Cell_FREE)));
+    EXPECT_CALL(displayPortMock, send_rvr(DisplayIndEq(0, 8, Cell_SNAKE)));
+
+    sut->receive(te.clone());
+}
+
+TEST_F(ArenaTest, test_HeadToBodyCollision_OnlyAttackerLoses)
+{
+    configureSUT("W 10 10 F 0 P 2 1 D 2 5 4 4 4 2 R 3 7 5 6 5 5 5");
+
+    EXPECT_CALL(scorePortMock, send_rvr(LooseIndFor(1)));
+    EXPECT_CALL(displayPortMock, send_rvr(DisplayIndEq(4, 4, Cell_FREE)));
+    EXPECT_CALL(displayPortMock, send_rvr(DisplayIndEq(5, 4, Cell_FREE)));
+    EXPECT_CALL(displayPortMock, send_rvr(DisplayIndEq(5, 5, Cell_FREE)));
+    EXPECT_CALL(displayPortMock, send_rvr(DisplayIndEq(8, 5, Cell_SNAKE)));
+
+    sut->receive(te.clone());
+}
+
+TEST_F(ArenaTest, test_EatingFood_ScoresForPlayerAndRequestsFood)
+{
+    configureSUT("W 10 10 F 2 6 5 0 0 P 1 3 R 1 5 5");
+
+    EXPECT_CALL(scorePortMock, send_rvr(ScoreIndFor(3)));
+    EXPECT_CALL(foodPortMock, send_rvr(AnyFoodReq()));
+    EXPECT_CALL(displayPortMock, send_rvr(DisplayIndEq(6, 5, Cell_SNAKE)));
+
+    sut->receive(te.clone());
+}
+
+TEST_F(ArenaTest, test_ReceiveFoodResp_PlacesFoodOnlyInFreeCell)
+{
+    configureSUT("W 10 10 F 1 0 0 P 1 3 R 1 5 5");
+
+    FoodResp l_foodResp;
+    l_foodResp.x = 5;
+    l_foodResp.y = 5;
+    EXPECT_CALL(foodPortMock, send_rvr(AnyFoodReq()));
+    sut->receive(std::make_unique<EventT<FoodResp>>(l_foodResp));
+
+    l_foodResp.x = 0;
+    l_foodResp.y = 0;
+    EXPECT_CALL(foodPortMock, send_rvr(AnyFoodReq()));
+    sut->receive(std::make_unique<EventT<FoodResp>>(l_foodResp));
+
+    l_foodResp.x = 7;
+    l_foodResp.y = 7;
+    EXPECT_CALL(displayPortMock, send_rvr(DisplayIndEq(7, 7, Cell_FOOD)));
+    sut->receive(std::make_unique<EventT<FoodResp>>(l_foodResp));
+}
+
+} // namespace Snake
@@ -0,0 +1,304 @@
+#include "AsyncFood.hpp"
+
+#include <optional>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "FoodServiceStub.hpp"
+
+using namespace ::testing;
+
+namespace Snake
+{
+
+struct AsyncFoodTest : Test
+{
+    static Task<> storeFood(AsyncPort& p_foodPort, GameState const& p_state, std::optional<std::pair<int, int>>& p_food)
+    {
+        p_food = co_await requestFood(p_foodPort, p_state);
+    }
+
+    static Body makeBody()
+    {
+        Body l_body;
+        l_body.pushHead(Segment{19, 20});
+        l_body.pushHead(Segment{20, 20});
+        return l_body;
+    }
+
+    GameState state{std::make_pair(100, 100), std::make_pair(50, 50), Direction_RIGHT, makeBody()};
+    LocalExecutor executor;
+};
+
+TEST_F(AsyncFoodTest, test_CollidingFood_IsRequestedAgain)
+{
+    FoodServiceStub l_service(executor, {{20, 20}, {19, 20}, {30, 30}});
+    AsyncPort l_foodPort(l_service, executor);
+    l_service.connect(l_foodPort);
+
+    std::optional<std::pair<int, int>> l_food;
+    spawn(executor, storeFood(l_foodPort, state, l_food));
+    executor.run();
+
+    EXPECT_EQ(std::make_pair(30, 30), l_food);
+    EXPECT_EQ(3u, l_service.served());
+    EXPECT_EQ(0u, l_foodPort.outstanding());
+}
+
+TEST_F(AsyncFoodTest, test_ManyGames_KeepRequestsInFlightAtOnce)
+{
+    FoodServiceStub l_service(executor, {{30, 30}, {31, 31}});
+    AsyncPort l_foodPort(l_service, executor);
+    l_service.connect(l_foodPort);
+
+    std::vector<GameState> l_games(100, state);
+    std::vector<std::optional<std::pair<int, int>>> l_foods(l_games.size());
+    for (std::size_t i = 0; i < l_games.size(); ++i) {
+        spawn(executor, storeFood(l_foodPort, l_games[i], l_foods[i]));
+    }
+    executor.run();
+
+    EXPECT_EQ(100u, l_service.maxInFlight);
+    for (std::size_t i = 0; i < l_foods.size(); ++i) {
+        EXPECT_EQ(i % 2 ? std::make_pair(31, 31) : std::make_pair(30, 30), l_foods[i]);
+    }
+}
+
+struct ManualPort : IPort
+{
+    void send(std::unique_ptr<Event> p_evt) override { sent.push_back(std::move(p_evt)); }
+
+    std::vector<std::unique_ptr<Event>> sent;
+};
+
+TEST_F(AsyncFoodTest, test_FoodPortDestroyedWhileRequesting_YieldsNoFood)
+{
+    ManualPort l_service;
+    auto l_foodPort = std::make_unique<AsyncPort>(l_service, executor);
+
+    std::optional<std::pair<int, int>> l_food = std::make_pair(0, 0);
+    spawn(executor, storeFood(*l_foodPort, state, l_food));
+    executor.run();
+    ASSERT_EQ(1u, l_service.sent.size());
+
+    l_foodPort.reset();
+    executor.run();
+
+    EXPECT_FALSE(l_food);
+}
+
+struct RecordingHandler : IEventHandler
+{
+    void receive(std::unique_ptr<Event> p_evt) override { received.push_back(std::move(p_evt)); }
+
+    std::vector<std::unique_ptr<Event>> received;
+};
+
+TEST_F(AsyncFoodTest, test_ServiceStub_NumbersAnswersInOwnOrderAndEchoesCorrelation)
+{
+    FoodServiceStub l_service(executor, {{30, 30}});
+    RecordingHandler l_client;
+    l_service.connect(l_client);
+
+    for (std::uint32_t l_correlationId : {8u, 9u}) {
+        auto l_req = std::make_unique<EventT<FoodReq>>();
+        l_req->setSequence({5, l_correlationId + 10});
+        l_req->setCorrelationId(l_correlationId);
+        l_service.send(std::move(l_req));
+    }
+    executor.run();
+
+    ASSERT_EQ(2u, l_client.received.size());
+    for (std::uint32_t i = 0; i < 2; ++i) {
+        auto const& l_resp = *l_client.received[i];
+        EXPECT_EQ(i, l_resp.getSequence().number);
+        EXPECT_EQ(18u + i, l_resp.getSequence().tick);
+        EXPECT_EQ(8u + i, l_resp.getCorrelationId());
+    }
+}
+
+struct AsyncPortTest : Test
+{
+    std::vector<int> received;
+    int cancelledCount = 0;
+
+    LocalExecutor executor;
+    ManualPort port;
+    AsyncPort sut{port, executor};
+
+    Task<> requester(AsyncPort& p_port)
+    {
+        if (auto const l_resp = co_await p_port.request<FoodReq, FoodResp>()) {
+            received.push_back(l_resp->x);
+        } else {
+            ++cancelledCount;
+        }
+    }
+
+    Task<> requester() { return requester(sut); }
+
+    std::unique_ptr<Event> response(int p_x, Event const* p_request)
+    {
+        FoodResp l_resp;
+        l_resp.x = p_x;
+        l_resp.y = 0;
+        auto l_evt = std::make_unique<EventT<FoodResp>>(l_resp);
+        if (p_request) {
+            l_evt->setCorrelationId(p_request->getCorrelationId());
+        }
+        return l_evt;
+    }
+};
+
+TEST_F(AsyncPortTest, test_CorrelatedResponses_ResumeMatchingRequests)
+{
+    spawn(executor, requester());
+    spawn(executor, requester());
+    executor.run();
+    ASSERT_EQ(2u, port.sent.size());
+    ASSERT_TRUE(port.sent[0]->isCorrelated());
+
+    sut.receive(response(2, port.sent[1].get()));
+    sut.receive(response(2, port.sent[1].get()));
+    sut.receive(response(1, port.sent[0].get()));
+    executor.run();
+
+    EXPECT_EQ(std::vector<int>({2, 1}), received);
+    EXPECT_EQ(0u, sut.outstanding());
+}
+
+TEST_F(AsyncPortTest, test_ResponseSequence_IsNotUsedForMatching)
+{
+    spawn(executor, requester());
+    spawn(executor, requester());
+    executor.run();
+
+    auto l_evt = response(2, port.sent[1].get());
+    l_evt->setSequence(port.sent[0]->getSequence());
+    sut.receive(std::move(l_evt));
+    executor.run();
+
+    EXPECT_EQ(std::vector<int>({2}), received);
+    EXPECT_EQ(1u, sut.outstanding());
+
+    sut.receive(response(1, port.sent[0].get()));
+    executor.run();
+}
+
+TEST_F(AsyncPortTest, test_RequestsAreNumberedInSendOrder)
+{
+    spawn(executor, requester());
+    spawn(executor, requester());
+    executor.run();
+
+    ASSERT_TRUE(port.sent[1]->isSequenced());
+    EXPECT_EQ(port.sent[0]->getSequence().number + 1, port.sent[1]->getSequence().number);
+
+    sut.receive(response(1, port.sent[0].get()));
+    sut.receive(response(2, port.sent[1].get()));
+    executor.run();
+}
+
+TEST_F(AsyncPortTest, test_UncorrelatedResponse_ResumesOldestRequest)
+{
+    spawn(executor, requester());
+    spawn(executor, requester());
+    executor.run();
+
+    sut.receive(response(1, nullptr));
+    executor.run();
+
+    EXPECT_EQ(std::vector<int>({1}), received);
+    EXPECT_EQ(1u, sut.outstanding());
+
+    sut.receive(response(2, nullptr));
+    executor.run();
+
+    EXPECT_EQ(std::vector<int>({1, 2}), received);
+}
+
+TEST_F(AsyncPortTest, test_ResponseWithOtherMessageId_IsDropped)
+{
+    spawn(executor, requester());
+    executor.run();
+
+    auto l_evt = std::make_unique<EventT<FoodInd>>();
+    l_evt->setCorrelationId(port.sent[0]->getCorrelationId());
+    sut.receive(std::move(l_evt));
+    executor.run();
+
+    EXPECT_TRUE(received.empty());
+    EXPECT_EQ(1u, sut.outstanding());
+
+    sut.receive(response(1, port.sent[0].get()));
+    executor.run();
+
+    EXPECT_EQ(std::vector<int>({1}), received);
+}
+
+TEST_F(AsyncPortTest, test_RequestCarriesGivenTick)
+{
+    auto l_awaiter = sut.request<FoodReq, FoodResp>(FoodReq(), 7);
+    l_awaiter.await_suspend(std::noop_coroutine());
+
+    ASSERT_EQ(1u, port.sent.size());
+    EXPECT_EQ(7u, port.sent[0]->getSequence().tick);
+}
+
+TEST_F(AsyncPortTest, test_AwaiterDestroyedBeforeResponse_ResponseIsDropped)
+{
+    {
+        auto l_awaiter = sut.request<FoodReq, FoodResp>();
+        l_awaiter.await_suspend(std::noop_coroutine());
+        EXPECT_EQ(1u, sut.outstanding());
+    }
+    EXPECT_EQ(0u, sut.outstanding());
+
+    sut.receive(response(1, port.sent[0].get()));
+    EXPECT_EQ(0u, executor.run());
+}
+
+TEST_F(AsyncPortTest, test_AwaiterDestroyedWhileResumeQueued_IsNotResumed)
+{
+    {
+        auto l_awaiter = sut.request<FoodReq, FoodResp>();
+        l_awaiter.await_suspend(std::noop_coroutine());
+        sut.receive(response(1, port.sent[0].get()));
+    }
+
+    EXPECT_EQ(1u, executor.run());
+    EXPECT_EQ(0u, sut.outstanding());
+}
+
+TEST_F(AsyncPortTest, test_PortDestroyedWithPendingRequests_ResumesThemWithoutResponse)
+{
+    auto l_port = std::make_unique<AsyncPort>(port, executor);
+    spawn(executor, requester(*l_port));
+    spawn(executor, requester(*l_port));
+    executor.run();
+    ASSERT_EQ(2u, l_port->outstanding());
+
+    l_port->receive(response(1, port.sent[0].get()));
+    l_port.reset();
+    executor.run();
+
+    EXPECT_EQ(std::vector<int>({1}), received);
+    EXPECT_EQ(1, cancelledCount);
+}
+
+TEST_F(AsyncPortTest, test_ExecutorDestroyedWithQueuedWork_DropsIt)
+{
+    auto l_executor = std::make_unique<LocalExecutor>();
+    auto l_port = std::make_unique<AsyncPort>(port, *l_executor);
+    auto l_awaiter = l_port->request<FoodReq, FoodResp>();
+    l_awaiter.await_suspend(std::noop_coroutine());
+    l_port->receive(response(1, port.sent[0].get()));
+
+    l_port.reset();
+    l_executor.reset();
+
+    EXPECT_TRUE(received.empty());
+}
+
+} // namespace Snake
@@ -0,0 +1,247 @@
+#include "GameState.hpp"
+
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include "AllocationCounter.hpp"
+
+using namespace ::testing;
+
+namespace Snake
+{
+
+struct BodyTest : Test
+{
+    Body body;
+
+    void grow(int p_length)
+    {
+        for (int i = 0; i < p_length; ++i) {
+            body.pushHead(Segment{i, 0});
+        }
+    }
+};
+
+TEST_F(BodyTest, test_PushedSegments_AreReturnedInQueueOrder)
+{
+    grow(200);
+
+    for (int i = 0; i < 200; ++i) {
+        EXPECT_EQ(200u - i, body.size());
+        EXPECT_EQ(199, body.head().x);
+        EXPECT_EQ(i, body.popTail().x);
+    }
+    EXPECT_TRUE(body.empty());
+}
+
+TEST_F(BodyTest, test_Contains_LooksOnlyAtLiveSegments)
+{
+    grow(100);
+    body.popTail();
+
+    EXPECT_FALSE(body.contains(Segment{0, 0}));
+    EXPECT_TRUE(body.contains(Segment{1, 0}));
+    EXPECT_TRUE(body.contains(Segment{99, 0}));
+    EXPECT_FALSE(body.contains(Segment{100, 0}));
+}
+
+TEST_F(BodyTest, test_ModifyingCopy_LeavesOriginalIntact)
+{
+    grow(100);
+
+    Body fork = body;
+    fork.popTail();
+    fork.pushHead(Segment{100, 0});
+    fork.pushHead(Segment{101, 0});
+
+    EXPECT_EQ(100u, body.size());
+    EXPECT_EQ(0, body.tail().x);
+    EXPECT_EQ(99, body.head().x);
+    EXPECT_FALSE(body.contains(Segment{100, 0}));
+
+    body.pushHead(Segment{-1, -1});
+
+    EXPECT_EQ(101u, fork.size());
+    EXPECT_EQ(101, fork.head().x);
+    EXPECT_FALSE(fork.contains(Segment{-1, -1}));
+}
+
+TEST_F(BodyTest, test_StepOfForkedLongBody_AllocatesOnlyHeadChunk)
+{
+    grow(10000);
+    body.popTail();
+    Body l_fork = body;
+
+    std::size_t l_firstStep, l_nextSteps;
+    {
+        AllocationCounter l_counter;
+        l_fork.popTail();
+        l_fork.pushHead(Segment{10000, 1});
+        l_firstStep = l_counter.count();
+    }
+    {
+        AllocationCounter l_counter;
+        for (int i = 1; i < 100; ++i) {
+            l_fork.popTail();
+            l_fork.pushHead(Segment{10000 + i, 1});
+        }
+        l_nextSteps = l_counter.count();
+    }
+
+    // sealing a chunk while the list is shared copies the list once and opens a new head chunk
+    EXPECT_EQ(1u, l_firstStep);
+    EXPECT_LE(l_nextSteps, 3u);
+    EXPECT_EQ(Segment({9999, 0}), body.head());
+    EXPECT_EQ(Segment({1, 0}), body.tail());
+    EXPECT_EQ(Segment({10099, 1}), l_fork.head());
+    EXPECT_EQ(Segment({101, 0}), l_fork.tail());
+}
+
+TEST_F(BodyTest, test_ForksSealingChunksAfterDiverging_KeepOwnSegments)
+{
+    grow(100);
+    Body l_fork = body;
+
+    for (int i = 0; i < 300; ++i) {
+        body.popTail();
+        body.pushHead(Segment{i, 1});
+        l_fork.popTail();
+        l_fork.pushHead(Segment{i, 2});
+    }
+
+    EXPECT_EQ(100u, body.size());
+    EXPECT_EQ(Segment({200, 1}), body.tail());
+    EXPECT_EQ(Segment({299, 1}), body.head());
+    EXPECT_TRUE(body.contains(Segment{250, 1}));
+    EXPECT_FALSE(body.contains(Segment{250, 2}));
+
+    EXPECT_EQ(Segment({200, 2}), l_fork.tail());
+    EXPECT_EQ(Segment({299, 2}), l_fork.head());
+    EXPECT_TRUE(l_fork.contains(Segment{250, 2}));
+    EXPECT_FALSE(l_fork.contains(Segment{250, 1}));
+}
+
+TEST_F(BodyTest, test_ForksSteppedOnTwoThreads_KeepOwnSegments)
+{
+    grow(1000);
+    Body l_forks[] = {body, body};
+
+    auto l_step = [](Body& p_body, int p_y) {
+        for (int i = 0; i < 5000; ++i) {
+            p_body.popTail();
+            p_body.pushHead(Segment{i, p_y});
+            p_body.contains(Segment{i, 0});
+        }
+    };
+    std::thread l_first(l_step, std::ref(l_forks[0]), 1);
+    std::thread l_second(l_step, std::ref(l_forks[1]), 2);
+    l_first.join();
+    l_second.join();
+
+    for (int y = 1; y <= 2; ++y) {
+        auto const& l_fork = l_forks[y - 1];
+        EXPECT_EQ(1000u, l_fork.size());
+        EXPECT_EQ(Segment({4000, y}), l_fork.tail());
+        EXPECT_EQ(Segment({4999, y}), l_fork.head());
+        EXPECT_FALSE(l_fork.contains(Segment{4500, 3 - y}));
+    }
+    EXPECT_EQ(Segment({0, 0}), body.tail());
+    EXPECT_EQ(Segment({999, 0}), body.head());
+}
+
+TEST_F(BodyTest, test_BodyOnSmallMap_IsPacked)
+{
+    EXPECT_TRUE(Body(std::make_pair(32768, 100)).isPacked());
+    EXPECT_FALSE(Body(std::make_pair(32769, 100)).isPacked());
+    EXPECT_FALSE(Body(std::make_pair(100, 100000)).isPacked());
+}
+
+TEST_F(BodyTest, test_WideBody_KeepsSegmentsOutOfPackedRange)
+{
+    Body l_wide(std::make_pair(100000, 100000));
+    l_wide.pushHead(Segment{99999, 0});
+    l_wide.pushHead(Segment{99999, 99999});
+
+    EXPECT_EQ(Segment({99999, 0}), l_wide.tail());
+    EXPECT_EQ(Segment({99999, 99999}), l_wide.head());
+    EXPECT_TRUE(l_wide.contains(Segment{99999, 99999}));
+    EXPECT_FALSE(l_wide.contains(Segment{99999, 99998}));
+}
+
+TEST_F(BodyTest, test_SegmentOutOfPackedRange_WidensPackedBody)
+{
+    grow(200);
+    body.pushHead(Segment{-1, 0});
+    Body l_fork = body;
+
+    body.pushHead(Segment{70000, -70000});
+
+    EXPECT_FALSE(body.isPacked());
+    EXPECT_EQ(202u, body.size());
+    EXPECT_EQ(Segment({0, 0}), body.tail());
+    EXPECT_TRUE(body.contains(Segment{-1, 0}));
+    EXPECT_TRUE(body.contains(Segment{150, 0}));
+    EXPECT_EQ(Segment({70000, -70000}), body.head());
+
+    EXPECT_TRUE(l_fork.isPacked());
+    EXPECT_EQ(Segment({-1, 0}), l_fork.head());
+    EXPECT_FALSE(l_fork.contains(Segment{70000, -70000}));
+}
+
+struct GameStateTest : Test
+{
+    Body makeBody()
+    {
+        Body l_body;
+        l_body.pushHead(Segment{18, 20});
+        l_body.pushHead(Segment{19, 20});
+        l_body.pushHead(Segment{20, 20});
+        return l_body;
+    }
+
+    GameState state{std::make_pair(100, 100), std::make_pair(21, 20), Direction_RIGHT, makeBody()};
+};
+
+TEST_F(GameStateTest, test_EatingFood_GrowsSnake)
+{
+    auto l_result = state.step();
+
+    EXPECT_EQ(StepOutcome_ATE, l_result.outcome);
+    EXPECT_EQ(4u, state.body().size());
+
+    state.step();
+    state.step();
+
+    EXPECT_EQ(4u, state.body().size());
+    EXPECT_EQ(20, state.body().tail().x);
+}
+
+TEST_F(GameStateTest, test_ForkedStateTriesMovesAhead_OriginalStateUnchanged)
+{
+    GameState l_fork = state;
+    l_fork.turn(Direction_UP);
+    auto l_result = l_fork.step();
+
+    EXPECT_EQ(StepOutcome_MOVED, l_result.outcome);
+    EXPECT_EQ(Segment({20, 19}), l_result.head);
+    EXPECT_EQ(Segment({18, 20}), l_result.freedTail);
+
+    EXPECT_EQ(Direction_RIGHT, state.direction());
+    EXPECT_EQ(Segment({20, 20}), state.body().head());
+    EXPECT_EQ(Segment({18, 20}), state.body().tail());
+}
+
+TEST_F(GameStateTest, test_StepIntoBody_IsLost)
+{
+    state.step();
+    state.turn(Direction_UP);
+    state.step();
+    state.turn(Direction_LEFT);
+    state.step();
+    state.turn(Direction_DOWN);
+
+    EXPECT_EQ(StepOutcome_LOST, state.step().outcome);
+}
+
+} // namespace Snake
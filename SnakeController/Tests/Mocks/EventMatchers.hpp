@@ -30,6 +30,26 @@ MATCHER(AnyScoreInd, "")
     return ScoreInd::MESSAGE_ID == arg.getMessageId();
 }
 
+MATCHER_P(LooseIndFor, p_playerId, "")
+{
+    if (LooseInd::MESSAGE_ID != arg.getMessageId()) {
+        *result_listener << "message with id = 0x" << std::hex << arg.getMessageId();
+        return false;
+    }
+    *result_listener << "carrying LooseInd(" << payload<LooseInd>(arg).playerId << ")";
+    return payload<LooseInd>(arg).playerId == p_playerId;
+}
+
+MATCHER_P(ScoreIndFor, p_playerId, "")
+{
+    if (ScoreInd::MESSAGE_ID != arg.getMessageId()) {
+        *result_listener << "message with id = 0x" << std::hex << arg.getMessageId();
+        return false;
+    }
+    *result_listener << "carrying ScoreInd(" << payload<ScoreInd>(arg).playerId << ")";
+    return payload<ScoreInd>(arg).playerId == p_playerId;
+}
+
 MATCHER(AnyFoodReq, "")
 {
     *result_listener << "message with id = 0x" << std::hex << arg.getMessageId();
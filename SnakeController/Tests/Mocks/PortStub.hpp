@@ -0,0 +1,18 @@
+#pragma once
+
+#include <cstddef>
+
+#include "IPort.hpp"
+
+namespace Snake
+{
+
+class PortStub : public IPort
+{
+public:
+    void send(std::unique_ptr<Event>) override { ++sentCount; }
+
+    std::size_t sentCount = 0;
+};
+
+} // namespace Snake
@@ -0,0 +1,185 @@
+#include "SnakeController.hpp"
+
+#include "EventT.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <sstream>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "AllocationCounter.hpp"
+#include "Mocks/PortStub.hpp"
+
+using namespace ::testing;
+
+namespace Snake
+{
+
+struct SnakePerformanceBudgetTest : Test
+{
+    EventT<TimeoutInd> te;
+
+    PortStub displayPort;
+    PortStub foodPort;
+    PortStub scorePort;
+
+    void configureSUT(std::string p_config, std::size_t p_reorderWindow = 0)
+    {
+        sut = std::make_unique<Controller>(displayPort, foodPort, scorePort, p_config, p_reorderWindow);
+    }
+
+    std::size_t sentCount() const
+    {
+        return displayPort.sentCount + foodPort.sentCount + scorePort.sentCount;
+    }
+
+    // every message sent through a port is one allocation, nothing else may allocate
+    void expectOnlyMessagesAllocated(std::unique_ptr<Event> p_evt)
+    {
+        auto const l_sentBefore = sentCount();
+        std::size_t l_allocations;
+        {
+            AllocationCounter l_counter;
+            sut->receive(std::move(p_evt));
+            l_allocations = l_counter.count();
+        }
+        EXPECT_EQ(sentCount() - l_sentBefore, l_allocations);
+    }
+
+    static std::string longSnake(int p_length)
+    {
+        std::ostringstream l_config;
+        l_config << "W 4000 10 F 0 9 S R " << p_length;
+        for (int x = p_length - 1; x >= 0; --x) {
+            l_config << ' ' << x << " 0";
+        }
+        return l_config.str();
+    }
+
+    std::unique_ptr<Controller> sut = nullptr;
+};
+
+TEST_F(SnakePerformanceBudgetTest, test_SteadyStateTimeoutInd_AllocatesOnlySentMessages)
+{
+    configureSUT(longSnake(200));
+    for (int i = 0; i < 300; ++i) {
+        sut->receive(te.clone());
+    }
+
+    for (int i = 0; i < 500; ++i) {
+        expectOnlyMessagesAllocated(te.clone());
+    }
+    EXPECT_EQ(0u, scorePort.sentCount);
+}
+
+TEST_F(SnakePerformanceBudgetTest, test_SequencedTimeoutInd_AllocatesOnlySentMessages)
+{
+    configureSUT(longSnake(200), 8);
+    std::uint32_t l_number = 0;
+    auto l_sequencedTimeout = [&] {
+        auto l_evt = te.clone();
+        l_evt->setSequence({l_number, l_number});
+        ++l_number;
+        return l_evt;
+    };
+
+    for (int i = 0; i < 300; ++i) {
+        sut->receive(l_sequencedTimeout());
+    }
+
+    for (int i = 0; i < 500; ++i) {
+        expectOnlyMessagesAllocated(l_sequencedTimeout());
+    }
+}
+
+TEST_F(SnakePerformanceBudgetTest, test_EatingTimeoutInd_AllocatesOnlySentMessages)
+{
+    configureSUT("W 100 100 F 21 20 S R 1 20 20");
+
+    expectOnlyMessagesAllocated(te.clone());
+    EXPECT_EQ(1u, scorePort.sentCount);
+    EXPECT_EQ(1u, foodPort.sentCount);
+}
+
+TEST_F(SnakePerformanceBudgetTest, test_DirectionInd_DoesNotAllocate)
+{
+    configureSUT(longSnake(200));
+    EventT<DirectionInd> l_toDown;
+    l_toDown->direction = Direction_DOWN;
+
+    expectOnlyMessagesAllocated(l_toDown.clone());
+    EXPECT_EQ(0u, sentCount());
+}
+
+TEST_F(SnakePerformanceBudgetTest, test_FoodResp_AllocatesOnlySentMessages)
+{
+    configureSUT(longSnake(200));
+    FoodResp l_free;
+    l_free.x = 300;
+    l_free.y = 5;
+    FoodResp l_colliding;
+    l_colliding.x = 100;
+    l_colliding.y = 0;
+
+    expectOnlyMessagesAllocated(std::make_unique<EventT<FoodResp>>(l_free));
+    expectOnlyMessagesAllocated(std::make_unique<EventT<FoodResp>>(l_colliding));
+    EXPECT_EQ(2u, sentCount());
+}
+
+#ifdef SNAKE_LATENCY_BUDGET_CYCLES
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+namespace
+{
+// TSC cycles on x86; steady_clock nanoseconds elsewhere.
+std::uint64_t readCycleCounter()
+{
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+#endif
+}
+} // namespace
+
+TEST_F(SnakePerformanceBudgetTest, test_LongSnakeTimeoutInd_MedianLatencyWithinBudget)
+{
+    int const l_width = 1000;
+    int const l_rows = 50;
+
+    std::vector<std::pair<int, int>> l_tailToHead;
+    for (int y = 0; y < l_rows; ++y) {
+        for (int i = 0; i < l_width; ++i) {
+            l_tailToHead.emplace_back(y % 2 ? l_width - 1 - i : i, y);
+        }
+    }
+
+    std::ostringstream l_config;
+    l_config << "W " << l_width << ' ' << l_width << " F 999 999 S D " << l_tailToHead.size();
+    std::for_each(l_tailToHead.rbegin(), l_tailToHead.rend(), [&](auto const& p_segment) {
+        l_config << ' ' << p_segment.first << ' ' << p_segment.second;
+    });
+    configureSUT(l_config.str());
+
+    std::vector<std::uint64_t> l_cycles;
+    for (int i = 0; i < 501; ++i) {
+        auto l_evt = te.clone();
+        auto const l_start = readCycleCounter();
+        sut->receive(std::move(l_evt));
+        l_cycles.push_back(readCycleCounter() - l_start);
+    }
+    ASSERT_EQ(0u, scorePort.sentCount);
+
+    std::nth_element(l_cycles.begin(), l_cycles.begin() + l_cycles.size() / 2, l_cycles.end());
+    EXPECT_LE(l_cycles[l_cycles.size() / 2], static_cast<std::uint64_t>(SNAKE_LATENCY_BUDGET_CYCLES));
+}
+
+#endif // SNAKE_LATENCY_BUDGET_CYCLES
+
+} // namespace Snake
@@ -20,9 +20,9 @@ struct SnakeTest : Test
     StrictMock<PortMock> foodPortMock;
     StrictMock<PortMock> scorePortMock;
 
-    void configureSUT(std::string p_config)
+    void configureSUT(std::string p_config, std::size_t p_reorderWindow = 0)
     {
-        sut = std::make_unique<Controller>(displayPortMock, foodPortMock, scorePortMock, p_config);
+        sut = std::make_unique<Controller>(displayPortMock, foodPortMock, scorePortMock, p_config, p_reorderWindow);
     }
 
     std::unique_ptr<Controller> sut = nullptr;
@@ -257,6 +257,27 @@ TEST_F(SnakeEatTestSuite, test_IfFoodEncountered_SendFoodRequestAndScoreIndicati
     sut->receive(te.clone());
 }
 
+TEST_F(SnakeEatTestSuite, test_AfterEating_SnakeKeepsItsNewLength)
+{
+    EXPECT_CALL(displayPortMock, send_rvr(DisplayIndEq(21, 20, Cell_SNAKE)));
+    EXPECT_CALL(foodPortMock, send_rvr(AnyFoodReq()));
+    EXPECT_CALL(scorePortMock, send_rvr(AnyScoreInd()));
+    sut->receive(te.clone());
+
+    Sequence l_freeSeq, l_takeSeq;
+    EXPECT_CALL(displayPortMock, send_rvr(DisplayIndEq(20, 20, Cell_FREE))).InSequence(l_freeSeq);
+    EXPECT_CALL(displayPortMock, send_rvr(DisplayIndEq(22, 20, Cell_SNAKE))).InSequence(l_takeSeq);
+    sut->receive(te.clone());
+
+    EXPECT_CALL(displayPortMock, send_rvr(DisplayIndEq(21, 20, Cell_FREE))).InSequence(l_freeSeq);
+    EXPECT_CALL(displayPortMock, send_rvr(DisplayIndEq(23, 20, Cell_SNAKE))).InSequence(l_takeSeq);
+    sut->receive(te.clone());
+
+    EXPECT_CALL(displayPortMock, send_rvr(DisplayIndEq(22, 20, Cell_FREE))).InSequence(l_freeSeq);
+    EXPECT_CALL(displayPortMock, send_rvr(DisplayIndEq(24, 20, Cell_SNAKE))).InSequence(l_takeSeq);
+    sut->receive(te.clone());
+}
+
 TEST_F(SnakeEatTestSuite, test_ReceiveFoodResp_PlaceFoodInCell)
 {
     FoodResp l_foodResp;
@@ -279,6 +300,32 @@ TEST_F(SnakeEatTestSuite, test_ReceiveFoodRespDetectsCollision_ThenRequestNewFoo
     sut->receive(std::make_unique<EventT<FoodResp>>(l_foodResp));
 }
 
+TEST_F(SnakeEatTestSuite, test_FoodReqCarriesTick_FoodRespForOlderTickIsDropped)
+{
+    std::uint32_t l_requestTick = 0;
+    EXPECT_CALL(displayPortMock, send_rvr(DisplayIndEq(21, 20, Cell_SNAKE)));
+    EXPECT_CALL(scorePortMock, send_rvr(AnyScoreInd()));
+    EXPECT_CALL(foodPortMock, send_rvr(AnyFoodReq()))
+        .WillOnce(Invoke([&](Event const& p_evt) { l_requestTick = p_evt.getSequence().tick; }));
+
+    sut->receive(te.clone());
+    ASSERT_EQ(1u, l_requestTick);
+
+    FoodResp l_foodResp;
+    l_foodResp.x = 50;
+    l_foodResp.y = 50;
+
+    auto l_stale = std::make_unique<EventT<FoodResp>>(l_foodResp);
+    l_stale->setSequence({0, l_requestTick - 1});
+    sut->receive(std::move(l_stale));
+
+    EXPECT_CALL(displayPortMock, send_rvr(DisplayIndEq(50, 50, Cell_FOOD)));
+
+    auto l_current = std::make_unique<EventT<FoodResp>>(l_foodResp);
+    l_current->setSequence({1, l_requestTick});
+    sut->receive(std::move(l_current));
+}
+
 struct SnakeNewFoodTest : SnakeTest
 {
     void SetUp() override
@@ -310,4 +357,109 @@ TEST_F(SnakeNewFoodTest, test_ReceiveFoodIndDetectsCollision_ThenRequestNewFood)
     sut->receive(std::make_unique<EventT<FoodInd>>(l_foodInd));
 }
 
+struct SnakeSequencedTest : SnakeTest
+{
+    void SetUp() override
+    {
+        configureSUT("W 100 100 F 50 50 S R 1 20 20", 4);
+    }
+
+    std::unique_ptr<Event> timeout(std::uint32_t p_number)
+    {
+        auto l_evt = te.clone();
+        l_evt->setSequence({p_number, p_number});
+        return l_evt;
+    }
+
+    std::unique_ptr<Event> turn(Direction p_direction, std::uint32_t p_number)
+    {
+        DirectionInd l_directionInd;
+        l_directionInd.direction = p_direction;
+
+        auto l_evt = std::make_unique<EventT<DirectionInd>>(l_directionInd);
+        l_evt->setSequence({p_number, p_number});
+        return l_evt;
+    }
+};
+
+TEST_F(SnakeSequencedTest, test_CloneKeepsSequenceAndCorrelationId)
+{
+    auto l_evt = timeout(7);
+    l_evt->setCorrelationId(3);
+
+    auto l_clone = l_evt->clone();
+
+    ASSERT_TRUE(l_clone->isSequenced());
+    EXPECT_EQ(7u, l_clone->getSequence().number);
+    EXPECT_EQ(7u, l_clone->getSequence().tick);
+    ASSERT_TRUE(l_clone->isCorrelated());
+    EXPECT_EQ(3u, l_clone->getCorrelationId());
+}
+
+TEST_F(SnakeSequencedTest, test_DuplicatedTimeoutInd_SnakeMovesOnce)
+{
+    EXPECT_CALL(displayPortMock, send_rvr(DisplayIndEq(20, 20, Cell_FREE)));
+    EXPECT_CALL(displayPortMock, send_rvr(DisplayIndEq(21, 20, Cell_SNAKE)));
+
+    sut->receive(timeout(0));
+    sut->receive(timeout(0));
+}
+
+TEST_F(SnakeSequencedTest, test_ReorderedEvents_HandledInSequenceOrder)
+{
+    sut->receive(timeout(1));
+    sut->receive(timeout(2));
+
+    InSequence l_seq;
+    EXPECT_CALL(displayPortMock, send_rvr(DisplayIndEq(20, 20, Cell_FREE)));
+    EXPECT_CALL(displayPortMock, send_rvr(DisplayIndEq(20, 21, Cell_SNAKE)));
+    EXPECT_CALL(displayPortMock, send_rvr(DisplayIndEq(20, 21, Cell_FREE)));
+    EXPECT_CALL(displayPortMock, send_rvr(DisplayIndEq(20, 22, Cell_SNAKE)));
+
+    sut->receive(turn(Direction_DOWN, 0));
+}
+
+TEST_F(SnakeSequencedTest, test_EventOlderThanHandledOnes_IsDropped)
+{
+    EXPECT_CALL(displayPortMock, send_rvr(DisplayIndEq(20, 20, Cell_FREE)));
+    EXPECT_CALL(displayPortMock, send_rvr(DisplayIndEq(21, 20, Cell_SNAKE)));
+
+    sut->receive(timeout(0));
+    sut->receive(turn(Direction_DOWN, 0));
+    Mock::VerifyAndClearExpectations(&displayPortMock);
+
+    EXPECT_CALL(displayPortMock, send_rvr(DisplayIndEq(21, 20, Cell_FREE)));
+    EXPECT_CALL(displayPortMock, send_rvr(DisplayIndEq(22, 20, Cell_SNAKE)));
+
+    sut->receive(timeout(1));
+}
+
+TEST_F(SnakeSequencedTest, test_WindowOverflow_SkipsMissingEvent)
+{
+    sut->receive(timeout(1));
+    sut->receive(timeout(2));
+    sut->receive(timeout(3));
+
+    EXPECT_CALL(displayPortMock, send_rvr(DisplayIndEq(20, 20, Cell_FREE)));
+    EXPECT_CALL(displayPortMock, send_rvr(DisplayIndEq(21, 20, Cell_SNAKE)));
+    EXPECT_CALL(displayPortMock, send_rvr(DisplayIndEq(21, 20, Cell_FREE)));
+    EXPECT_CALL(displayPortMock, send_rvr(DisplayIndEq(22, 20, Cell_SNAKE)));
+    EXPECT_CALL(displayPortMock, send_rvr(DisplayIndEq(22, 20, Cell_FREE)));
+    EXPECT_CALL(displayPortMock, send_rvr(DisplayIndEq(23, 20, Cell_SNAKE)));
+    EXPECT_CALL(displayPortMock, send_rvr(DisplayIndEq(23, 20, Cell_FREE)));
+    EXPECT_CALL(displayPortMock, send_rvr(DisplayIndEq(24, 20, Cell_SNAKE)));
+
+    sut->receive(timeout(4));
+}
+
+TEST_F(SnakeSequencedTest, test_UnsequencedEvent_HandledImmediately)
+{
+    sut->receive(timeout(1));
+
+    EXPECT_CALL(displayPortMock, send_rvr(DisplayIndEq(20, 20, Cell_FREE)));
+    EXPECT_CALL(displayPortMock, send_rvr(DisplayIndEq(21, 20, Cell_SNAKE)));
+
+    sut->receive(te.clone());
+}
+
 } // namespace Snake